@@ -14,10 +14,38 @@
 
 typedef struct stat stat_t;
 
+#define WCORE_URING_DEFAULT_ENTRIES 64
+#define WCORE_DIRECT_ALIGNMENT 4096
+
+typedef struct wcore_uring wcore_uring_t;
+
+typedef enum {
+    WCORE_ADVICE_NORMAL = 0,
+    WCORE_ADVICE_SEQUENTIAL,
+    WCORE_ADVICE_RANDOM,
+    WCORE_ADVICE_WILLNEED,
+    WCORE_ADVICE_DONTNEED
+} wcore_advice_t;
+
+typedef struct {
+    uint8_t* buffer;
+    size_t buffer_size;
+    size_t offset;
+    ssize_t result;
+} wcore_segment_t;
+
+typedef struct {
+    uint64_t user_data;
+    int32_t result;
+} wcore_uring_cqe_t;
+
+// Ошибки: функции возвращают -1 (false, отрицательный fd) и оставляют причину в errno.
+// Ядро ничего не печатает, сообщать об ошибке должен вызывающий код
 CORE_EXTERN_C int wcore_o_read(const char* path);
 CORE_EXTERN_C int wcore_o_write(const char* path);
 CORE_EXTERN_C int wcore_o_append(const char* path);
 CORE_EXTERN_C int wcore_read_and_write(const char* path);
+CORE_EXTERN_C int wcore_o_tmpfile(const char* dir_path);
 
 CORE_EXTERN_C void wcore_close(int fd);
 
@@ -25,6 +53,8 @@ CORE_EXTERN_C ssize_t wcore_cread(
     int fd, uint8_t* buffer, size_t buffer_size, bool* is_eof, size_t* cursor);
 CORE_EXTERN_C ssize_t wcore_custom_read(
     int fd, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof);
+CORE_EXTERN_C ssize_t wcore_custom_readv(
+    int fd, wcore_segment_t* segments, size_t count, bool* is_eof);
 
 CORE_EXTERN_C bool wcore_awrite(
     int fd, const uint8_t* buffer, size_t buffer_size);
@@ -32,9 +62,68 @@ CORE_EXTERN_C bool wcore_cwrite(
     int fd, const uint8_t* buffer, size_t buffer_size, size_t* cursor);
 CORE_EXTERN_C bool wcore_custom_write(
     int fd, const uint8_t* buffer, size_t offset, size_t buffer_size);
+CORE_EXTERN_C bool wcore_awritev(
+    int fd, wcore_segment_t* segments, size_t count);
+CORE_EXTERN_C bool wcore_custom_writev(
+    int fd, wcore_segment_t* segments, size_t count);
 
 CORE_EXTERN_C void wcore_update_stat(int fd, stat_t* file_stat);
 
 CORE_EXTERN_C int wcore_unlink_file(const char* file_name);
+CORE_EXTERN_C bool wcore_link_tmpfile(int fd, const char* path);
+CORE_EXTERN_C bool wcore_reserve(int fd, size_t size);
+CORE_EXTERN_C bool wcore_sync(int fd);
+CORE_EXTERN_C bool wcore_fsync(int fd);
+CORE_EXTERN_C bool wcore_sync_dir(const char* path);
+CORE_EXTERN_C bool wcore_write_behind(int fd);
+CORE_EXTERN_C ssize_t wcore_copy_range(
+    int fd_in, size_t offset_in, int fd_out, size_t offset_out, size_t size);
+
+CORE_EXTERN_C bool wcore_fadvise(int fd, wcore_advice_t advice, size_t offset, size_t size);
+CORE_EXTERN_C bool wcore_madvise(
+    uint8_t* map, size_t map_size, wcore_advice_t advice, size_t offset, size_t size);
+
+CORE_EXTERN_C bool wcore_set_direct(int fd, bool enable);
+CORE_EXTERN_C ssize_t wcore_direct_cread(
+    int fd, uint8_t* buffer, size_t buffer_size, bool* is_eof, size_t* cursor);
+CORE_EXTERN_C ssize_t wcore_direct_custom_read(
+    int fd, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof);
+CORE_EXTERN_C bool wcore_direct_cwrite(
+    int fd, const uint8_t* buffer, size_t buffer_size, size_t* cursor);
+CORE_EXTERN_C bool wcore_direct_custom_write(
+    int fd, const uint8_t* buffer, size_t offset, size_t buffer_size);
+
+CORE_EXTERN_C bool wcore_map_file(int fd, uint8_t** data, size_t* size);
+CORE_EXTERN_C void wcore_unmap_file(uint8_t* data, size_t size);
+CORE_EXTERN_C ssize_t wcore_mapped_cread(
+    const uint8_t* map, size_t map_size, uint8_t* buffer, size_t buffer_size, bool* is_eof, size_t* cursor);
+CORE_EXTERN_C ssize_t wcore_mapped_custom_read(
+    const uint8_t* map, size_t map_size, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof);
+
+CORE_EXTERN_C wcore_uring_t* wcore_uring_create(unsigned entries);
+CORE_EXTERN_C void wcore_uring_destroy(wcore_uring_t* ring);
+CORE_EXTERN_C unsigned wcore_uring_capacity(const wcore_uring_t* ring);
+
+CORE_EXTERN_C bool wcore_uring_prep_read(
+    wcore_uring_t* ring, int fd, uint8_t* buffer, size_t offset, size_t buffer_size, uint64_t user_data);
+CORE_EXTERN_C bool wcore_uring_prep_write(
+    wcore_uring_t* ring, int fd, const uint8_t* buffer, size_t offset, size_t buffer_size, uint64_t user_data);
+CORE_EXTERN_C int wcore_uring_submit(wcore_uring_t* ring, unsigned wait_nr);
+CORE_EXTERN_C int wcore_uring_wait(wcore_uring_t* ring);
+CORE_EXTERN_C size_t wcore_uring_reap(wcore_uring_t* ring, wcore_uring_cqe_t* cqes, size_t max_count);
+
+CORE_EXTERN_C ssize_t wcore_uring_cread(
+    wcore_uring_t* ring, int fd, uint8_t* buffer, size_t buffer_size, bool* is_eof, size_t* cursor);
+CORE_EXTERN_C ssize_t wcore_uring_custom_read(
+    wcore_uring_t* ring, int fd, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof);
+CORE_EXTERN_C ssize_t wcore_uring_custom_read_batch(
+    wcore_uring_t* ring, int fd, wcore_segment_t* segments, size_t count, bool* is_eof);
+
+CORE_EXTERN_C bool wcore_uring_cwrite(
+    wcore_uring_t* ring, int fd, const uint8_t* buffer, size_t buffer_size, size_t* cursor);
+CORE_EXTERN_C bool wcore_uring_custom_write(
+    wcore_uring_t* ring, int fd, const uint8_t* buffer, size_t offset, size_t buffer_size);
+CORE_EXTERN_C bool wcore_uring_custom_write_batch(
+    wcore_uring_t* ring, int fd, wcore_segment_t* segments, size_t count);
 
 // NOLINTEND
@@ -0,0 +1,53 @@
+// NOLINTBEGIN  Copyright 2025 wiserin
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "core.h"
+
+
+bool wcore_fadvise(int fd, wcore_advice_t advice, size_t offset, size_t size) {
+    int posix_advice = POSIX_FADV_NORMAL;
+
+    switch (advice) {
+        case WCORE_ADVICE_NORMAL: posix_advice = POSIX_FADV_NORMAL; break;
+        case WCORE_ADVICE_SEQUENTIAL: posix_advice = POSIX_FADV_SEQUENTIAL; break;
+        case WCORE_ADVICE_RANDOM: posix_advice = POSIX_FADV_RANDOM; break;
+        case WCORE_ADVICE_WILLNEED: posix_advice = POSIX_FADV_WILLNEED; break;
+        case WCORE_ADVICE_DONTNEED: posix_advice = POSIX_FADV_DONTNEED; break;
+    }
+
+    return posix_fadvise(fd, (off_t) offset, (off_t) size, posix_advice) == 0;
+}
+
+
+bool wcore_madvise(
+        uint8_t* map, size_t map_size, wcore_advice_t advice, size_t offset, size_t size) {
+
+    if (map == NULL || offset >= map_size) {
+        return true;
+    }
+    if (size == 0 || size > map_size - offset) {
+        size = map_size - offset;
+    }
+
+    // madvise требует адрес, выровненный по странице
+    size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+    size_t aligned_offset = offset - offset % page_size;
+    size += offset - aligned_offset;
+
+    int posix_advice = POSIX_MADV_NORMAL;
+    switch (advice) {
+        case WCORE_ADVICE_NORMAL: posix_advice = POSIX_MADV_NORMAL; break;
+        case WCORE_ADVICE_SEQUENTIAL: posix_advice = POSIX_MADV_SEQUENTIAL; break;
+        case WCORE_ADVICE_RANDOM: posix_advice = POSIX_MADV_RANDOM; break;
+        case WCORE_ADVICE_WILLNEED: posix_advice = POSIX_MADV_WILLNEED; break;
+        case WCORE_ADVICE_DONTNEED: posix_advice = POSIX_MADV_DONTNEED; break;
+    }
+
+    return posix_madvise(map + aligned_offset, size, posix_advice) == 0;
+}
+// NOLINTEND
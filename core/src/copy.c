@@ -0,0 +1,100 @@
+// NOLINTBEGIN  Copyright 2025 wiserin
+#define _GNU_SOURCE
+#include <stddef.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <sys/sendfile.h>
+
+#include "core.h"
+
+#define WCORE_COPY_MAX_OP_SIZE (1U << 30)
+
+
+// Ошибки, после которых копирование внутри ядра этим способом невозможно и нужно пробовать следующий
+static bool wcore_is_copy_unsupported(int error) {
+    return error == ENOSYS || error == EXDEV || error == EINVAL ||
+           error == EOPNOTSUPP || error == EBADF || error == ETXTBSY;
+}
+
+
+static ssize_t wcore_copy_file_range(
+        int fd_in, size_t offset_in, int fd_out, size_t offset_out, size_t size, bool* is_unsupported) {
+
+    loff_t in = (loff_t) offset_in;
+    loff_t out = (loff_t) offset_out;
+    size_t count = 0;
+
+    while (count < size) {
+        size_t part = size - count > WCORE_COPY_MAX_OP_SIZE ? WCORE_COPY_MAX_OP_SIZE : size - count;
+        ssize_t res = copy_file_range(fd_in, &in, fd_out, &out, part, 0);
+
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (count == 0 && wcore_is_copy_unsupported(errno)) {
+                *is_unsupported = true;
+                return 0;
+            }
+            return -1;
+        } else if (res == 0) {
+            break;
+        }
+        count += res;
+    }
+
+    return count;
+}
+
+
+// sendfile пишет с текущей позиции fd_out, остальные функции ядра используют pwrite и от нее не зависят
+static ssize_t wcore_sendfile(
+        int fd_in, size_t offset_in, int fd_out, size_t offset_out, size_t size, bool* is_unsupported) {
+
+    if (lseek(fd_out, (off_t) offset_out, SEEK_SET) < 0) {
+        *is_unsupported = true;
+        return 0;
+    }
+
+    off_t in = (off_t) offset_in;
+    size_t count = 0;
+
+    while (count < size) {
+        size_t part = size - count > WCORE_COPY_MAX_OP_SIZE ? WCORE_COPY_MAX_OP_SIZE : size - count;
+        ssize_t res = sendfile(fd_out, fd_in, &in, part);
+
+        if (res < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            if (count == 0 && wcore_is_copy_unsupported(errno)) {
+                *is_unsupported = true;
+                return 0;
+            }
+            return -1;
+        } else if (res == 0) {
+            break;
+        }
+        count += res;
+    }
+
+    return count;
+}
+
+
+ssize_t wcore_copy_range(
+        int fd_in, size_t offset_in, int fd_out, size_t offset_out, size_t size) {
+
+    bool is_unsupported = false;
+    ssize_t count = wcore_copy_file_range(fd_in, offset_in, fd_out, offset_out, size, &is_unsupported);
+    if (!is_unsupported) {
+        return count;
+    }
+
+    is_unsupported = false;
+    return wcore_sendfile(fd_in, offset_in, fd_out, offset_out, size, &is_unsupported);
+}
+// NOLINTEND
@@ -0,0 +1,256 @@
+// NOLINTBEGIN  Copyright 2025 wiserin
+#define _GNU_SOURCE
+#include <stddef.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdbool.h>
+
+#include "core.h"
+
+#define WCORE_DIRECT_BOUNCE_SIZE (1024 * 1024)
+
+
+static bool wcore_is_aligned(size_t value) {
+    return value % WCORE_DIRECT_ALIGNMENT == 0;
+}
+
+
+static size_t wcore_align_up(size_t value) {
+    return (value + WCORE_DIRECT_ALIGNMENT - 1) & ~((size_t) WCORE_DIRECT_ALIGNMENT - 1);
+}
+
+
+bool wcore_set_direct(int fd, bool enable) {
+    int flags = fcntl(fd, F_GETFL);
+    if (flags < 0) {
+        return false;
+    }
+    flags = enable ? (flags | O_DIRECT) : (flags & ~O_DIRECT);
+
+    return fcntl(fd, F_SETFL, flags) == 0;
+}
+
+
+// Чтение с выровненными buffer/offset/buffer_size. Короткий невыровненный ответ ядра означает конец файла
+static ssize_t wcore_direct_aligned_read(
+        int fd, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof) {
+
+    size_t count = 0;
+
+    while (count < buffer_size) {
+        ssize_t c_bytes = pread(fd, buffer + count, buffer_size - count, offset + count);
+
+        if (c_bytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        count += c_bytes;
+        if (c_bytes == 0 || (count < buffer_size && !wcore_is_aligned(count))) {
+            *is_eof = true;
+            break;
+        }
+    }
+
+    return count;
+}
+
+
+// Невыровненный кусок читается через выровненный промежуточный буфер
+static ssize_t wcore_direct_bounce_read(
+        int fd, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof) {
+
+    size_t bounce_size = wcore_align_up(buffer_size + WCORE_DIRECT_ALIGNMENT);
+    if (bounce_size > WCORE_DIRECT_BOUNCE_SIZE) {
+        bounce_size = WCORE_DIRECT_BOUNCE_SIZE;
+    }
+    void* bounce = NULL;
+    if (posix_memalign(&bounce, WCORE_DIRECT_ALIGNMENT, bounce_size) != 0) {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    size_t count = 0;
+    while (count < buffer_size) {
+        size_t position = offset + count;
+        size_t aligned_offset = position & ~((size_t) WCORE_DIRECT_ALIGNMENT - 1);
+        size_t delta = position - aligned_offset;
+        size_t span = wcore_align_up(delta + buffer_size - count);
+        if (span > bounce_size) {
+            span = bounce_size;
+        }
+
+        bool chunk_eof = false;
+        ssize_t res = wcore_direct_aligned_read(fd, bounce, aligned_offset, span, &chunk_eof);
+        if (res < 0) {
+            free(bounce);
+            return -1;
+        }
+
+        size_t available = (size_t) res > delta ? (size_t) res - delta : 0;
+        size_t take = buffer_size - count < available ? buffer_size - count : available;
+        memcpy(buffer + count, (uint8_t*) bounce + delta, take);
+        count += take;
+
+        if (chunk_eof && count < buffer_size) {
+            *is_eof = true;
+            break;
+        }
+    }
+    free(bounce);
+
+    return count;
+}
+
+
+ssize_t wcore_direct_custom_read(
+        int fd, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof) {
+
+    if (!wcore_is_aligned((uintptr_t) buffer) || !wcore_is_aligned(offset)) {
+        return wcore_direct_bounce_read(fd, buffer, offset, buffer_size, is_eof);
+    }
+
+    size_t head = buffer_size - buffer_size % WCORE_DIRECT_ALIGNMENT;
+    bool head_eof = false;
+    ssize_t count = wcore_direct_aligned_read(fd, buffer, offset, head, &head_eof);
+    if (count < 0 || head_eof) {
+        *is_eof = *is_eof || head_eof;
+        return count;
+    }
+    if (head == buffer_size) {
+        return count;
+    }
+
+    ssize_t tail = wcore_direct_bounce_read(fd, buffer + head, offset + head, buffer_size - head, is_eof);
+    if (tail < 0) {
+        return -1;
+    }
+
+    return count + tail;
+}
+
+
+ssize_t wcore_direct_cread(
+        int fd, uint8_t* buffer, size_t buffer_size, bool* is_eof, size_t* cursor) {
+
+    ssize_t count = wcore_direct_custom_read(fd, buffer, *cursor, buffer_size, is_eof);
+    if (count > 0) {
+        *cursor += count;
+    }
+    return count;
+}
+
+
+// Крайний блок дочитывается с диска, за концом файла он дополняется нулями
+static bool wcore_direct_read_block(int fd, uint8_t* block, size_t offset) {
+    bool is_eof = false;
+    ssize_t res = wcore_direct_aligned_read(fd, block, offset, WCORE_DIRECT_ALIGNMENT, &is_eof);
+    if (res < 0) {
+        return false;
+    }
+    memset(block + res, 0, WCORE_DIRECT_ALIGNMENT - res);
+    return true;
+}
+
+
+// Невыровненный кусок пишется через выровненный промежуточный буфер. Частично задетые крайние блоки
+// сначала читаются с диска (read-modify-write), поэтому параллельная запись в те же блоки не безопасна.
+// Флаги fd не меняются: они общие для всех, кто пользуется этим описанием файла
+static bool wcore_direct_bounce_write(
+        int fd, const uint8_t* buffer, size_t offset, size_t buffer_size) {
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) < 0) {
+        return false;
+    }
+    size_t file_size = file_stat.st_size;
+
+    size_t bounce_size = wcore_align_up(buffer_size + WCORE_DIRECT_ALIGNMENT);
+    if (bounce_size > WCORE_DIRECT_BOUNCE_SIZE) {
+        bounce_size = WCORE_DIRECT_BOUNCE_SIZE;
+    }
+    void* bounce = NULL;
+    if (posix_memalign(&bounce, WCORE_DIRECT_ALIGNMENT, bounce_size) != 0) {
+        errno = ENOMEM;
+        return false;
+    }
+
+    bool state = true;
+    size_t count = 0;
+    while (count < buffer_size) {
+        size_t position = offset + count;
+        size_t aligned_offset = position & ~((size_t) WCORE_DIRECT_ALIGNMENT - 1);
+        size_t delta = position - aligned_offset;
+        size_t take = buffer_size - count < bounce_size - delta ? buffer_size - count : bounce_size - delta;
+        size_t span = wcore_align_up(delta + take);
+        size_t last_block = span - WCORE_DIRECT_ALIGNMENT;
+
+        if (delta > 0 && !wcore_direct_read_block(fd, bounce, aligned_offset)) {
+            state = false;
+            break;
+        }
+        bool is_last_read = delta > 0 && last_block == 0;
+        if (!wcore_is_aligned(delta + take) && !is_last_read
+                && !wcore_direct_read_block(fd, (uint8_t*) bounce + last_block, aligned_offset + last_block)) {
+            state = false;
+            break;
+        }
+
+        memcpy((uint8_t*) bounce + delta, buffer + count, take);
+        if (!wcore_custom_write(fd, bounce, aligned_offset, span)) {
+            state = false;
+            break;
+        }
+        count += take;
+    }
+    int error = errno;
+    free(bounce);
+    if (!state) {
+        errno = error;
+        return false;
+    }
+
+    // Последний блок записан целиком и мог удлинить файл нулями за концом данных
+    size_t end = offset + buffer_size;
+    if (!wcore_is_aligned(end) && wcore_align_up(end) > file_size) {
+        return ftruncate(fd, end > file_size ? end : file_size) == 0;
+    }
+    return true;
+}
+
+
+bool wcore_direct_custom_write(
+        int fd, const uint8_t* buffer, size_t offset, size_t buffer_size) {
+
+    if (!wcore_is_aligned((uintptr_t) buffer) || !wcore_is_aligned(offset)) {
+        return wcore_direct_bounce_write(fd, buffer, offset, buffer_size);
+    }
+
+    size_t head = buffer_size - buffer_size % WCORE_DIRECT_ALIGNMENT;
+    if (head > 0 && !wcore_custom_write(fd, buffer, offset, head)) {
+        return false;
+    }
+    if (head == buffer_size) {
+        return true;
+    }
+
+    return wcore_direct_bounce_write(fd, buffer + head, offset + head, buffer_size - head);
+}
+
+
+bool wcore_direct_cwrite(
+        int fd, const uint8_t* buffer, size_t buffer_size, size_t* cursor) {
+
+    if (!wcore_direct_custom_write(fd, buffer, *cursor, buffer_size)) {
+        return false;
+    }
+    *cursor += buffer_size;
+    return true;
+}
+// NOLINTEND
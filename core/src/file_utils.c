@@ -1,9 +1,96 @@
 // NOLINTBEGIN  Copyright 2025 wiserin
+#define _GNU_SOURCE
 #include <core.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
 #include <unistd.h>
 
 
 int wcore_unlink_file(const char* file_name) {
     return unlink(file_name);
 }
+
+
+// AT_EMPTY_PATH требует CAP_DAC_READ_SEARCH на старых ядрах, поэтому есть запасной путь через /proc
+bool wcore_link_tmpfile(int fd, const char* path) {
+    if (linkat(fd, "", AT_FDCWD, path, AT_EMPTY_PATH) == 0) {
+        return true;
+    }
+
+    char proc_path[64];
+    snprintf(proc_path, sizeof(proc_path), "/proc/self/fd/%d", fd);
+    if (linkat(AT_FDCWD, proc_path, AT_FDCWD, path, AT_SYMLINK_FOLLOW) == 0) {
+        return true;
+    }
+    return false;
+}
+
+
+// FALLOC_FL_KEEP_SIZE резервирует экстенты, не меняя видимый размер файла,
+// поэтому дозапись через O_APPEND продолжает писать с реального конца
+bool wcore_reserve(int fd, size_t size) {
+    if (size == 0) {
+        return true;
+    }
+
+    while (fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, (off_t) size) < 0) {
+        if (errno == EINTR) {
+            continue;
+        }
+        return false;
+    }
+
+    return true;
+}
+
+
+bool wcore_sync(int fd) {
+    while (fdatasync(fd) < 0) {
+        if (errno == EINTR) {
+            continue;
+        }
+        return false;
+    }
+
+    return true;
+}
+
+
+bool wcore_fsync(int fd) {
+    while (fsync(fd) < 0) {
+        if (errno == EINTR) {
+            continue;
+        }
+        return false;
+    }
+
+    return true;
+}
+
+
+// Без синхронизации каталога переименование может не пережить сбой питания
+bool wcore_sync_dir(const char* path) {
+    int fd = open(path, O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return false;
+    }
+    bool state = wcore_fsync(fd);
+    close(fd);
+
+    return state;
+}
+
+
+// Дожидается записи, запущенной прошлым вызовом, и запускает запись новых грязных страниц, не ожидая ее
+bool wcore_write_behind(int fd) {
+    while (sync_file_range(fd, 0, 0, SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE) < 0) {
+        if (errno == EINTR) {
+            continue;
+        }
+        return false;
+    }
+
+    return true;
+}
 // NOLINTEND
\ No newline at end of file
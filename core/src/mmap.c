@@ -0,0 +1,70 @@
+// NOLINTBEGIN  Copyright 2025 wiserin
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "core.h"
+
+
+bool wcore_map_file(int fd, uint8_t** data, size_t* size) {
+    stat_t file_stat;
+    *data = NULL;
+    *size = 0;
+
+    if (fstat(fd, &file_stat) < 0) {
+        return false;
+    }
+    if (file_stat.st_size == 0) {
+        return true;
+    }
+
+    void* map = mmap(NULL, (size_t) file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    *data = (uint8_t*) map;
+    *size = (size_t) file_stat.st_size;
+
+    return true;
+}
+
+
+void wcore_unmap_file(uint8_t* data, size_t size) {
+    if (data != NULL) {
+        munmap(data, size);
+    }
+}
+
+
+ssize_t wcore_mapped_cread(
+        const uint8_t* map, size_t map_size, uint8_t* buffer,
+        size_t buffer_size, bool* is_eof, size_t* cursor) {
+
+    ssize_t count = wcore_mapped_custom_read(map, map_size, buffer, *cursor, buffer_size, is_eof);
+    *cursor += count;
+
+    return count;
+}
+
+
+ssize_t wcore_mapped_custom_read(
+        const uint8_t* map, size_t map_size, uint8_t* buffer,
+        size_t offset, size_t buffer_size, bool* is_eof) {
+
+    size_t available = offset < map_size ? map_size - offset : 0;
+    size_t count = buffer_size;
+
+    if (count > available) {
+        count = available;
+        *is_eof = true;
+    }
+    if (count > 0) {
+        memcpy(buffer, map + offset, count);
+    }
+
+    return (ssize_t) count;
+}
+// NOLINTEND
@@ -1,4 +1,5 @@
 // NOLINTBEGIN  Copyright 2025 wiserin
+#define _GNU_SOURCE
 #include <stddef.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -30,4 +31,17 @@ int wcore_read_and_write(const char* path) {
 
     return fd;
 }
+
+
+// Безымянный файл в каталоге dir_path, имя появляется только после wcore_link_tmpfile
+int wcore_o_tmpfile(const char* dir_path) {
+#ifdef O_TMPFILE
+    int fd = open(dir_path, O_RDWR | O_TMPFILE, 0666);
+
+    return fd;
+#else
+    (void) dir_path;
+    return -1;
+#endif
+}
 // NOLINTEND
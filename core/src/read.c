@@ -5,7 +5,6 @@
 #include <stdint.h>
 #include <errno.h>
 #include <stdbool.h>
-#include <stdio.h>
 
 
 ssize_t wcore_cread(
@@ -26,7 +25,6 @@ ssize_t wcore_cread(
             if (errno == EINTR) {
                 continue;
             }
-            printf("WiseIO core error (wcore_read). Errno: %d", errno);
             return -1;
         } else {
             count += c_bytes;
@@ -56,7 +54,6 @@ ssize_t wcore_custom_read(
             if (errno == EINTR) {
                 continue;
             }
-            printf("WiseIO core error (wcore_read). Errno: %d", errno);
             return -1;
         } else {
             count += c_bytes;
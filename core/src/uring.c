@@ -0,0 +1,491 @@
+// NOLINTBEGIN  Copyright 2025 wiserin
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#include "core.h"
+
+#if __has_include(<linux/io_uring.h>)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#define WCORE_HAS_URING 1
+#endif
+
+
+#ifdef WCORE_HAS_URING
+
+// Длина в SQE 32-битная, запросы режутся по 1 GiB и дочитываются повторной отправкой
+#define WCORE_URING_MAX_OP_SIZE (1U << 30)
+#define WCORE_URING_REAP_BATCH 32
+
+struct wcore_uring {
+    int ring_fd;
+    unsigned sq_entries;
+
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    struct io_uring_sqe* sqes;
+    size_t sqes_size;
+
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    struct io_uring_cqe* cqes;
+
+    unsigned sqe_tail;  // хвост с заполненными SQE, ядру публикуется в wcore_uring_submit
+    unsigned pending;
+    unsigned inflight;
+};
+
+
+static void wcore_uring_unmap(wcore_uring_t* ring) {
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED) {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED) {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+}
+
+
+wcore_uring_t* wcore_uring_create(unsigned entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    int ring_fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+    if (ring_fd < 0) {
+        return NULL;
+    }
+
+    wcore_uring_t* ring = calloc(1, sizeof(wcore_uring_t));
+    if (ring == NULL) {
+        close(ring_fd);
+        return NULL;
+    }
+    ring->ring_fd = ring_fd;
+    ring->sq_entries = params.sq_entries;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        goto fail;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cq_ring = ring->sq_ring;
+    } else {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            goto fail;
+        }
+    }
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        goto fail;
+    }
+
+    ring->sq_head = (unsigned*) ((char*) ring->sq_ring + params.sq_off.head);
+    ring->sq_tail = (unsigned*) ((char*) ring->sq_ring + params.sq_off.tail);
+    ring->sqe_tail = *ring->sq_tail;
+    ring->sq_mask = (unsigned*) ((char*) ring->sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned*) ((char*) ring->sq_ring + params.sq_off.array);
+
+    ring->cq_head = (unsigned*) ((char*) ring->cq_ring + params.cq_off.head);
+    ring->cq_tail = (unsigned*) ((char*) ring->cq_ring + params.cq_off.tail);
+    ring->cq_mask = (unsigned*) ((char*) ring->cq_ring + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*) ((char*) ring->cq_ring + params.cq_off.cqes);
+
+    return ring;
+
+fail:
+    wcore_uring_unmap(ring);
+    close(ring_fd);
+    free(ring);
+    return NULL;
+}
+
+
+void wcore_uring_destroy(wcore_uring_t* ring) {
+    if (ring == NULL) {
+        return;
+    }
+    wcore_uring_unmap(ring);
+    close(ring->ring_fd);
+    free(ring);
+}
+
+
+unsigned wcore_uring_capacity(const wcore_uring_t* ring) {
+    return ring->sq_entries - ring->pending - ring->inflight;
+}
+
+
+static struct io_uring_sqe* wcore_uring_get_sqe(wcore_uring_t* ring) {
+    if (wcore_uring_capacity(ring) == 0) {
+        return NULL;
+    }
+
+    unsigned index = ring->sqe_tail & *ring->sq_mask;
+    struct io_uring_sqe* sqe = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sq_array[index] = index;
+    ++ring->sqe_tail;
+    ++ring->pending;
+
+    return sqe;
+}
+
+
+bool wcore_uring_prep_read(
+        wcore_uring_t* ring, int fd, uint8_t* buffer,
+        size_t offset, size_t buffer_size, uint64_t user_data) {
+
+    struct io_uring_sqe* sqe = wcore_uring_get_sqe(ring);
+    if (sqe == NULL) {
+        return false;
+    }
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t) (uintptr_t) buffer;
+    sqe->len = buffer_size > WCORE_URING_MAX_OP_SIZE ? WCORE_URING_MAX_OP_SIZE : (uint32_t) buffer_size;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+
+    return true;
+}
+
+
+bool wcore_uring_prep_write(
+        wcore_uring_t* ring, int fd, const uint8_t* buffer,
+        size_t offset, size_t buffer_size, uint64_t user_data) {
+
+    struct io_uring_sqe* sqe = wcore_uring_get_sqe(ring);
+    if (sqe == NULL) {
+        return false;
+    }
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t) (uintptr_t) buffer;
+    sqe->len = buffer_size > WCORE_URING_MAX_OP_SIZE ? WCORE_URING_MAX_OP_SIZE : (uint32_t) buffer_size;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+
+    return true;
+}
+
+
+int wcore_uring_submit(wcore_uring_t* ring, unsigned wait_nr) {
+    unsigned flags = wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+    // Хвост публикуется только здесь, когда вызывающий уже заполнил все SQE: release упорядочивает их запись
+    __atomic_store_n(ring->sq_tail, ring->sqe_tail, __ATOMIC_RELEASE);
+
+    while (true) {
+        int res = (int) syscall(__NR_io_uring_enter, ring->ring_fd, ring->pending, wait_nr, flags, NULL, 0);
+
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        ring->pending -= (unsigned) res;
+        ring->inflight += (unsigned) res;
+        return res;
+    }
+}
+
+
+// Только ждет завершения, не отправляет SQE и не трогает счетчики кольца:
+// можно вызывать из одного потока, пока другие под своим мьютексом готовят и отправляют запросы
+int wcore_uring_wait(wcore_uring_t* ring) {
+    while (true) {
+        int res = (int) syscall(__NR_io_uring_enter, ring->ring_fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        return 0;
+    }
+}
+
+
+size_t wcore_uring_reap(wcore_uring_t* ring, wcore_uring_cqe_t* cqes, size_t max_count) {
+    unsigned head = *ring->cq_head;
+    unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    size_t count = 0;
+
+    while (head != tail && count < max_count) {
+        struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+        cqes[count].user_data = cqe->user_data;
+        cqes[count].result = cqe->res;
+        ++head;
+        ++count;
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    ring->inflight -= (unsigned) count;
+
+    return count;
+}
+
+
+// Дожидается всех отправленных операций: буферы нельзя отдавать вызывающему, пока ядро в них пишет
+static void wcore_uring_drain(wcore_uring_t* ring) {
+    wcore_uring_cqe_t cqes[WCORE_URING_REAP_BATCH];
+
+    while (ring->inflight > 0 || ring->pending > 0) {
+        if (wcore_uring_submit(ring, 1) < 0) {
+            return;
+        }
+        wcore_uring_reap(ring, cqes, WCORE_URING_REAP_BATCH);
+    }
+}
+
+
+static bool wcore_uring_prep_segment(
+        wcore_uring_t* ring, int fd, const wcore_segment_t* segment,
+        size_t done, uint64_t index, bool is_write) {
+
+    if (is_write) {
+        return wcore_uring_prep_write(
+            ring, fd, segment->buffer + done, segment->offset + done,
+            segment->buffer_size - done, index);
+    }
+    return wcore_uring_prep_read(
+        ring, fd, segment->buffer + done, segment->offset + done,
+        segment->buffer_size - done, index);
+}
+
+
+static bool wcore_uring_run_batch(
+        wcore_uring_t* ring, int fd, wcore_segment_t* segments,
+        size_t count, bool is_write, bool* is_eof) {
+
+    wcore_uring_cqe_t cqes[WCORE_URING_REAP_BATCH];
+    size_t next = 0;
+    size_t remaining = count;
+    bool state = true;
+    int error = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        segments[i].result = 0;
+    }
+
+    while (remaining > 0) {
+        while (next < count && wcore_uring_capacity(ring) > 0) {
+            if (segments[next].buffer_size == 0) {
+                --remaining;
+            } else {
+                wcore_uring_prep_segment(ring, fd, &segments[next], 0, next, is_write);
+            }
+            ++next;
+        }
+        if (remaining == 0) {
+            break;
+        }
+
+        if (wcore_uring_submit(ring, 1) < 0) {
+            error = errno;
+            wcore_uring_drain(ring);
+            errno = error;
+            return false;
+        }
+
+        size_t reaped = wcore_uring_reap(ring, cqes, WCORE_URING_REAP_BATCH);
+        for (size_t i = 0; i < reaped; ++i) {
+            wcore_segment_t* segment = &segments[cqes[i].user_data];
+            int32_t res = cqes[i].result;
+
+            if (res == -EINTR || res == -EAGAIN) {
+                wcore_uring_prep_segment(
+                    ring, fd, segment, segment->result, cqes[i].user_data, is_write);
+            } else if (res < 0) {
+                error = -res;
+                segment->result = -1;
+                state = false;
+                --remaining;
+            } else if (res == 0 && is_write) {
+                error = ENOSPC;
+                segment->result = -1;
+                state = false;
+                --remaining;
+            } else if (res == 0) {
+                if (is_eof != NULL) {
+                    *is_eof = true;
+                }
+                --remaining;
+            } else {
+                segment->result += res;
+                if ((size_t) segment->result < segment->buffer_size) {
+                    wcore_uring_prep_segment(
+                        ring, fd, segment, segment->result, cqes[i].user_data, is_write);
+                } else {
+                    --remaining;
+                }
+            }
+        }
+    }
+
+    if (!state) {
+        errno = error;
+    }
+    return state;
+}
+
+
+ssize_t wcore_uring_custom_read_batch(
+        wcore_uring_t* ring, int fd, wcore_segment_t* segments, size_t count, bool* is_eof) {
+
+    if (!wcore_uring_run_batch(ring, fd, segments, count, false, is_eof)) {
+        return -1;
+    }
+
+    ssize_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += segments[i].result;
+    }
+    return total;
+}
+
+
+bool wcore_uring_custom_write_batch(
+        wcore_uring_t* ring, int fd, wcore_segment_t* segments, size_t count) {
+
+    return wcore_uring_run_batch(ring, fd, segments, count, true, NULL);
+}
+
+#else
+
+wcore_uring_t* wcore_uring_create(unsigned entries) {
+    (void) entries;
+    return NULL;
+}
+
+
+void wcore_uring_destroy(wcore_uring_t* ring) {
+    (void) ring;
+}
+
+
+unsigned wcore_uring_capacity(const wcore_uring_t* ring) {
+    (void) ring;
+    return 0;
+}
+
+
+bool wcore_uring_prep_read(
+        wcore_uring_t* ring, int fd, uint8_t* buffer,
+        size_t offset, size_t buffer_size, uint64_t user_data) {
+    return false;
+}
+
+
+bool wcore_uring_prep_write(
+        wcore_uring_t* ring, int fd, const uint8_t* buffer,
+        size_t offset, size_t buffer_size, uint64_t user_data) {
+    return false;
+}
+
+
+int wcore_uring_submit(wcore_uring_t* ring, unsigned wait_nr) {
+    errno = ENOSYS;
+    return -1;
+}
+
+
+int wcore_uring_wait(wcore_uring_t* ring) {
+    errno = ENOSYS;
+    return -1;
+}
+
+
+size_t wcore_uring_reap(wcore_uring_t* ring, wcore_uring_cqe_t* cqes, size_t max_count) {
+    return 0;
+}
+
+
+ssize_t wcore_uring_custom_read_batch(
+        wcore_uring_t* ring, int fd, wcore_segment_t* segments, size_t count, bool* is_eof) {
+    errno = ENOSYS;
+    return -1;
+}
+
+
+bool wcore_uring_custom_write_batch(
+        wcore_uring_t* ring, int fd, wcore_segment_t* segments, size_t count) {
+    errno = ENOSYS;
+    return false;
+}
+
+#endif
+
+
+ssize_t wcore_uring_cread(
+        wcore_uring_t* ring, int fd, uint8_t* buffer, size_t buffer_size, bool* is_eof, size_t* cursor) {
+
+    ssize_t count = wcore_uring_custom_read(ring, fd, buffer, *cursor, buffer_size, is_eof);
+    if (count > 0) {
+        *cursor += count;
+    }
+    return count;
+}
+
+
+ssize_t wcore_uring_custom_read(
+        wcore_uring_t* ring, int fd, uint8_t* buffer, size_t offset, size_t buffer_size, bool* is_eof) {
+
+    wcore_segment_t segment = {buffer, buffer_size, offset, 0};
+    return wcore_uring_custom_read_batch(ring, fd, &segment, 1, is_eof);
+}
+
+
+bool wcore_uring_cwrite(
+        wcore_uring_t* ring, int fd, const uint8_t* buffer, size_t buffer_size, size_t* cursor) {
+
+    if (!wcore_uring_custom_write(ring, fd, buffer, *cursor, buffer_size)) {
+        return false;
+    }
+    *cursor += buffer_size;
+    return true;
+}
+
+
+bool wcore_uring_custom_write(
+        wcore_uring_t* ring, int fd, const uint8_t* buffer, size_t offset, size_t buffer_size) {
+
+    wcore_segment_t segment = {(uint8_t*) buffer, buffer_size, offset, 0};
+    return wcore_uring_custom_write_batch(ring, fd, &segment, 1);
+}
+// NOLINTEND
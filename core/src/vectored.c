@@ -0,0 +1,129 @@
+// NOLINTBEGIN  Copyright 2025 wiserin
+#include <stddef.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <sys/uio.h>
+
+#include "core.h"
+
+#define WCORE_IOV_BATCH 1024
+
+
+// Собирает iovec из подряд идущих в файле сегментов, начиная с segments[index] + done
+static size_t wcore_fill_iov(
+        struct iovec* iov, const wcore_segment_t* segments, size_t count,
+        size_t index, size_t done, bool is_contiguous_only, size_t* run_end) {
+
+    size_t n_iov = 0;
+    size_t j = index;
+
+    while (j < count && n_iov < WCORE_IOV_BATCH) {
+        if (is_contiguous_only && j > index &&
+                segments[j].offset != segments[j - 1].offset + segments[j - 1].buffer_size) {
+            break;
+        }
+        size_t skip = j == index ? done : 0;
+        iov[n_iov].iov_base = segments[j].buffer + skip;
+        iov[n_iov].iov_len = segments[j].buffer_size - skip;
+        ++n_iov;
+        ++j;
+    }
+    *run_end = j;
+
+    return n_iov;
+}
+
+
+static ssize_t wcore_vector_io(
+        int fd, wcore_segment_t* segments, size_t count,
+        bool is_write, bool is_positional, bool* is_eof) {
+
+    struct iovec iov[WCORE_IOV_BATCH];
+    size_t index = 0;
+    size_t done = 0;
+    ssize_t total = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        segments[i].result = 0;
+    }
+
+    while (index < count) {
+        if (done == segments[index].buffer_size) {
+            ++index;
+            done = 0;
+            continue;
+        }
+
+        size_t run_end = 0;
+        size_t n_iov = wcore_fill_iov(iov, segments, count, index, done, is_positional, &run_end);
+        off_t offset = (off_t) (segments[index].offset + done);
+
+        ssize_t res = 0;
+        if (is_write && is_positional) {
+            res = pwritev(fd, iov, (int) n_iov, offset);
+        } else if (is_write) {
+            res = writev(fd, iov, (int) n_iov);
+        } else {
+            res = preadv(fd, iov, (int) n_iov, offset);
+        }
+
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        } else if (res == 0) {
+            if (is_write) {
+                errno = ENOSPC;
+                return -1;
+            }
+            if (is_eof != NULL) {
+                *is_eof = true;
+            }
+            index = run_end;
+            done = 0;
+            continue;
+        }
+
+        total += res;
+        while (res > 0) {
+            size_t left = segments[index].buffer_size - done;
+            size_t take = (size_t) res < left ? (size_t) res : left;
+
+            segments[index].result += (ssize_t) take;
+            done += take;
+            res -= (ssize_t) take;
+            if (done == segments[index].buffer_size) {
+                ++index;
+                done = 0;
+            }
+        }
+    }
+
+    return total;
+}
+
+
+ssize_t wcore_custom_readv(
+        int fd, wcore_segment_t* segments, size_t count, bool* is_eof) {
+
+    return wcore_vector_io(fd, segments, count, false, true, is_eof);
+}
+
+
+bool wcore_custom_writev(
+        int fd, wcore_segment_t* segments, size_t count) {
+
+    return wcore_vector_io(fd, segments, count, true, true, NULL) >= 0;
+}
+
+
+bool wcore_awritev(
+        int fd, wcore_segment_t* segments, size_t count) {
+
+    return wcore_vector_io(fd, segments, count, true, false, NULL) >= 0;
+}
+// NOLINTEND
@@ -5,7 +5,6 @@
 #include <stdint.h>
 #include <errno.h>
 #include <stdbool.h>
-#include <stdio.h>
 
 
 bool wcore_awrite(
@@ -20,7 +19,6 @@ bool wcore_awrite(
             if (errno == EINTR) {
                 continue;
             }
-            printf("WiseIO core error (wcore_read). Errno: %d", errno);
             return false;
         }
         written += res;
@@ -42,7 +40,6 @@ bool wcore_cwrite(
             if (errno == EINTR) {
                 continue;
             }
-            printf("WiseIO core error (wcore_read). Errno: %d", errno);
             return false;
         }
         written += res;
@@ -66,7 +63,6 @@ bool wcore_custom_write(
             if (errno == EINTR) {
                 continue;
             }
-            printf("WiseIO core error (wcore_read). Errno: %d", errno);
             return false;
         }
         written += res;
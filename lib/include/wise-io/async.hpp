@@ -0,0 +1,167 @@
+#pragma once  // Copyright 2025 wiserin
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+using str = std::string;
+
+struct wcore_uring;
+
+namespace wiseio {
+
+// Одна операция ввода-вывода, отданная реактору. Живет внутри AsyncIO до возобновления корутины
+struct AsyncOp {
+    enum class Kind : uint8_t {
+        kRead,
+        kWrite
+    };
+
+    Kind kind = Kind::kRead;
+    int fd = -1;
+    bool is_direct = false;     // fd открыт с O_DIRECT
+    uint8_t* buffer = nullptr;  // для записи данные только читаются
+    size_t size = 0;
+    size_t offset = 0;
+    size_t done = 0;            // байт обработано, при чтении меньше size означает конец файла
+    int error = 0;              // errno, 0 при успехе
+    std::coroutine_handle<> continuation;
+};
+
+
+// Выполняет AsyncOp и возобновляет ожидающую корутину в своем потоке.
+// Submit может вызываться из любого потока
+class Reactor {
+    inline static std::atomic<Reactor*> default_reactor = nullptr;
+
+ protected:
+    // Блокирующее выполнение через pread/pwrite ядра
+    static void Execute(AsyncOp* op);
+
+ public:
+    Reactor() = default;
+    Reactor(const Reactor& another) = delete;
+    Reactor& operator=(const Reactor& another) = delete;
+    Reactor(Reactor&& another) = delete;
+    Reactor& operator=(Reactor&& another) = delete;
+
+    virtual void Submit(AsyncOp* op) = 0;
+
+    // Реактор для Async* вызовов без явного реактора. Пока не задан, используется
+    // общий, созданный через CreateReactor() при первом обращении
+    static void SetDefault(Reactor* reactor);
+    [[nodiscard]] static Reactor& GetDefault();
+
+    virtual ~Reactor() = default;
+};
+
+
+// Пул потоков, каждый выполняет операции обычными pread/pwrite
+class ThreadPoolReactor final : public Reactor {
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<AsyncOp*> queue_;
+    std::vector<std::thread> workers_;
+    bool is_stopped_ = false;
+
+    void Worker();
+
+ public:
+    static constexpr size_t kDefaultThreads = 4;
+
+    explicit ThreadPoolReactor(size_t threads = kDefaultThreads);
+
+    void Submit(AsyncOp* op) override;
+
+    // Дожидается всех уже отданных операций
+    ~ThreadPoolReactor() override;
+};
+
+
+// Одно кольцо io_uring на все стримы. Запросы отправляются прямо из Submit,
+// завершения собирает фоновый поток. Операции O_DIRECT с невыровненным буфером,
+// смещением или размером уходят во вспомогательный пул из одного потока
+class UringReactor final : public Reactor {
+    static constexpr size_t kReapBatch = 32;
+    static constexpr std::chrono::milliseconds kWaitBackoff {1};
+
+    wcore_uring* ring_;
+    ThreadPoolReactor fallback_ {1};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<AsyncOp*> queue_;  // ждут свободного места в кольце
+    size_t prepped_ = 0;          // SQE подготовлены, но еще не отправлены
+    size_t inflight_ = 0;         // отправлены ядру
+    std::unordered_set<AsyncOp*> in_ring_;  // подготовлены или отправлены, ждут CQE
+    bool is_broken_ = false;      // ожидание вернуло неисправимую ошибку, кольцо больше не используется
+    bool is_stopped_ = false;
+    std::thread worker_;
+
+    explicit UringReactor(wcore_uring* ring);
+
+    bool Prep(AsyncOp* op);
+    void SubmitPrepped();
+    void Break(int error, std::vector<AsyncOp*>& finished);
+    void Worker();
+
+ public:
+    // nullptr, если ядро не поддерживает io_uring
+    [[nodiscard]] static std::unique_ptr<UringReactor> Create(unsigned entries = 256);
+
+    void Submit(AsyncOp* op) override;
+
+    ~UringReactor() override;
+};
+
+
+// IOBackend::kIOUring дает UringReactor, если он доступен, иначе и для остальных backend пул потоков
+[[nodiscard]] std::unique_ptr<Reactor> CreateReactor(
+    IOBackend backend = IOBackend::kIOUring, size_t threads = ThreadPoolReactor::kDefaultThreads);
+
+
+// Результат Stream::Async*: co_await возвращает IOResult.
+// Операция отправляется реактору только в co_await, корутина продолжается в потоке реактора.
+// Буфер должен жить до завершения co_await
+class AsyncIO {
+    const Stream* stream_;
+    Stream* writer_ = nullptr;  // стрим записи: размер файла учитывается атомарно из потока реактора
+    Reactor* reactor_;  // nullptr: Reactor::GetDefault() в момент co_await
+    AsyncOp op_;
+    std::optional<IOResult> ready_;  // результат без обращения к реактору: ошибка режима, mmap, пустой буфер
+    bool is_append_ = false;
+    void* read_target_ = nullptr;  // буфер ReadAll, при возобновлении обрезается до прочитанного
+    void (*truncate_target_)(void* target, size_t size) = nullptr;
+
+    AsyncIO(const Stream* stream, Reactor* reactor);
+
+    friend class Stream;
+
+ public:
+    AsyncIO(const AsyncIO& another) = delete;
+    AsyncIO& operator=(const AsyncIO& another) = delete;
+    AsyncIO(AsyncIO&& another) noexcept = default;  // только до co_await
+    AsyncIO& operator=(AsyncIO&& another) = delete;
+
+    [[nodiscard]] bool await_ready() const noexcept;  // NOLINT(readability-identifier-naming)
+    void await_suspend(std::coroutine_handle<> handle);  // NOLINT(readability-identifier-naming)
+    IOResult await_resume();  // NOLINT(readability-identifier-naming)
+
+    ~AsyncIO() = default;
+};
+
+} // namespace wiseio
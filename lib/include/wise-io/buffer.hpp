@@ -1,7 +1,9 @@
 #pragma once  // Copyright 2025 wiserin
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <wise-io/schemas.hpp>
@@ -25,6 +27,8 @@ class BytesIOBuffer : public IOBuffer {
     std::vector<uint8_t> data_;
     size_t cursor_ = 0;
 
+    [[nodiscard]] size_t GetAvailable(size_t size) const;
+
  public:
     BytesIOBuffer() = default;
     BytesIOBuffer(const BytesIOBuffer& another) = default;
@@ -43,9 +47,13 @@ class BytesIOBuffer : public IOBuffer {
     [[nodiscard]] bool IsData() const;
 
     [[nodiscard]] std::vector<uint8_t> ReadFromBuffer(size_t size);
+    // Копирует до destination.size() байт без выделения памяти, возвращает число скопированных
+    size_t ReadFromBuffer(std::span<uint8_t> destination);  // NOLINT(modernize-use-nodiscard)
+    // До size байт без копирования. View действителен до следующего изменения буфера
+    [[nodiscard]] std::span<const uint8_t> Slice(size_t size);
     void Clear();
 
-    ~BytesIOBuffer() override = default;
+    ~BytesIOBuffer() override;
 };
 
 
@@ -57,14 +65,13 @@ class StringIOBuffer : public IOBuffer {
     bool ignore_comments_ = false;
     bool ignore_blank_ = false;
 
-    [[nodiscard]] bool Validate(std::vector<char>& line) const;
-
-    [[nodiscard]] bool IsBlank(const std::vector<char>& line) const;
-    [[nodiscard]] bool CommentChecker(std::vector<char>& line) const;
+    [[nodiscard]] bool Validate(std::string_view& line) const;
 
-    void DeleteComment(std::vector<char>& line) const;
+    [[nodiscard]] bool IsBlank(std::string_view line) const;
+    [[nodiscard]] bool CommentChecker(std::string_view& line) const;
 
-    [[nodiscard]] std::vector<char> ReadLine();
+    // Строка без '\n' как view в data_, действителен до следующего изменения буфера
+    [[nodiscard]] std::string_view ReadLine();
 
  public:
     StringIOBuffer() = default;
@@ -96,4 +103,76 @@ class StringIOBuffer : public IOBuffer {
 };
 
 
+class AlignedIOBuffer : public IOBuffer {
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+    size_t alignment_ = kDefaultAlignment;
+
+    void Release();
+
+ public:
+    static constexpr size_t kDefaultAlignment = 4096;
+
+    AlignedIOBuffer() = default;
+    explicit AlignedIOBuffer(size_t alignment);
+    AlignedIOBuffer(const AlignedIOBuffer& another) = delete;
+    AlignedIOBuffer& operator=(const AlignedIOBuffer& another) = delete;
+    AlignedIOBuffer(AlignedIOBuffer&& another) noexcept;
+    AlignedIOBuffer& operator=(AlignedIOBuffer&& another) noexcept;
+
+    [[nodiscard]] uint8_t* GetDataPtr() override;
+    [[nodiscard]] const uint8_t* GetDataPtr() const override;
+    [[nodiscard]] size_t GetBufferSize() const override;
+    void ResizeBuffer(size_t size) override;
+
+    [[nodiscard]] size_t GetCapacity() const;
+    [[nodiscard]] size_t GetAlignment() const;
+
+    [[nodiscard]] static size_t RoundUp(size_t size, size_t alignment);
+
+    ~AlignedIOBuffer() override;
+};
+
+
+
+// Кольцевой буфер фиксированной емкости: память выделяется один раз в конструкторе.
+// Данные не непрерывны, поэтому это не IOBuffer: Stream работает с окнами через span-перегрузки,
+// stream.CRead(ring.GetWriteWindow()) и CommitWrite, stream.CWrite(ring.GetReadWindow()) и Consume
+class RingIOBuffer {
+    std::vector<uint8_t> data_;
+    size_t head_ = 0;  // начало непрочитанных данных
+    size_t size_ = 0;  // непрочитанных байт
+
+    [[nodiscard]] size_t GetTail() const;
+    [[nodiscard]] size_t GetWriteWindowSize() const;
+
+ public:
+    explicit RingIOBuffer(size_t capacity);
+    RingIOBuffer(const RingIOBuffer& another) = default;
+    RingIOBuffer& operator=(const RingIOBuffer& another) = default;
+    // Исходный буфер остается пустым с нулевой емкостью
+    RingIOBuffer(RingIOBuffer&& another) noexcept;
+    RingIOBuffer& operator=(RingIOBuffer&& another) noexcept;
+
+    // Окна обрываются на конце памяти: после перехода через край нужен второй вызов
+    [[nodiscard]] std::span<uint8_t> GetWriteWindow();
+    void CommitWrite(size_t size);
+    [[nodiscard]] std::span<const uint8_t> GetReadWindow() const;
+    void Consume(size_t size);
+
+    // Копируют сколько помещается или сколько есть, с переходом через край
+    size_t Write(std::span<const uint8_t> data);  // NOLINT(modernize-use-nodiscard)
+    size_t Read(std::span<uint8_t> destination);  // NOLINT(modernize-use-nodiscard)
+
+    [[nodiscard]] size_t GetSize() const;
+    [[nodiscard]] size_t GetFree() const;
+    [[nodiscard]] size_t GetCapacity() const;
+    [[nodiscard]] bool IsEmpty() const;
+    [[nodiscard]] bool IsFull() const;
+    void Clear();
+
+    ~RingIOBuffer() = default;
+};
+
 } // namespace wiseio
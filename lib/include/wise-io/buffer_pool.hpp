@@ -0,0 +1,43 @@
+#pragma once  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace wiseio {
+
+struct BufferPoolCounters {
+    size_t allocations = 0;  // буферов выделено заново
+    size_t shared_hits = 0;  // буферов взято из общего запаса, а не из кэша потока
+    size_t dropped = 0;      // возвращенных буферов освобождено: бюджет запаса исчерпан
+    size_t shared_bytes = 0;  // байт сейчас лежит в общем запасе
+};
+
+
+// Общий пул байтовых векторов по классам размера (степени двойки от 256 B до 64 MiB).
+// Каждый поток держит небольшой кэш и берет из него без блокировок, общий запас под мьютексом
+// класса нужен, только когда кэш потока пуст или переполнен. Оба ограничены суммарным объемом:
+// буфер, который не помещается в бюджет, просто освобождается
+class BufferPool {
+ public:
+    static constexpr size_t kMinClassShift = 8;
+    static constexpr size_t kMaxClassShift = 26;
+    static constexpr size_t kClassCount = kMaxClassShift - kMinClassShift + 1;
+    static constexpr size_t kThreadCacheBytes = 4 * 1024 * 1024;  // на поток
+    static constexpr size_t kSharedBytes = 64 * 1024 * 1024;
+
+    BufferPool() = delete;
+
+    // Пустой вектор с capacity() >= size
+    [[nodiscard]] static std::vector<uint8_t> Acquire(size_t size);
+    static void Release(std::vector<uint8_t>&& buffer);
+
+    // Растит capacity до size через пул, содержимое сохраняется. Рост не меньше чем вдвое
+    static void Reserve(std::vector<uint8_t>& buffer, size_t size);
+
+    // Освобождает кэш вызывающего потока и общий запас
+    static void Trim();
+    [[nodiscard]] static BufferPoolCounters GetCounters();
+};
+
+} // namespace wiseio
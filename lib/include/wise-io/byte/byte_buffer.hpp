@@ -0,0 +1,53 @@
+#pragma once  // Copyright 2025 wiserin
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace wiseio {
+
+// polymorphic_allocator, у которого resize без значения оставляет новые элементы неинициализированными:
+// буфер под чтение не обнуляется, байты сразу перезаписывает pread
+template<typename T>
+class DefaultInitAllocator : public std::pmr::polymorphic_allocator<T> {
+    using Base = std::pmr::polymorphic_allocator<T>;
+
+ public:
+    using Base::Base;
+
+    DefaultInitAllocator() = default;
+
+    template<typename U>
+    DefaultInitAllocator(const DefaultInitAllocator<U>& another) noexcept  // NOLINT(google-explicit-constructor)
+            : Base(another.resource()) {}
+
+    template<typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) {
+        Base::construct(ptr, std::forward<Args>(args)...);
+    }
+
+    // Как у polymorphic_allocator: копия контейнера берет ресурс по умолчанию
+    [[nodiscard]] DefaultInitAllocator select_on_container_copy_construction() const {
+        return {};
+    }
+};
+
+
+// Байты хранилища чанка, выделяются из memory_resource хранилища
+using ByteBuffer = std::vector<uint8_t, DefaultInitAllocator<uint8_t>>;
+
+
+inline bool operator==(const ByteBuffer& lhs, const std::vector<uint8_t>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+} // namespace wiseio
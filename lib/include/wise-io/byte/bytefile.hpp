@@ -1,11 +1,16 @@
 #pragma once  // Copyright 2025 wiserin
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "wise-io/byte/chunks.hpp"
 #include "wise-io/concepts.hpp"
+#include "wise-io/schemas.hpp"
 #include "wise-io/stream.hpp"
 
 
@@ -15,9 +20,28 @@ using str = std::string;
 namespace wiseio {
 
 class ByteFileEngine {
+    static constexpr size_t kCompileFlushSize = 8 * 1024 * 1024;
+    static constexpr size_t kLinkAttempts = 8;
+
+    // Диапазон старого файла, который переносится в новый без чтения в память
+    struct CopyRun {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint64_t out_offset = 0;
+    };
+
     wiseio::Stream istream_;
     std::filesystem::path file_name_;
 
+    static void FlushCompiled(
+        Stream& ostream, std::vector<std::vector<uint8_t>>& compiled, std::vector<WriteSegment>& segments);
+    void FlushCopy(Stream& ostream, CopyRun& run);
+    void LinkCompiled(Stream& ostream);
+
+    [[nodiscard]] bool CanCompileInPlace(std::span<const ChunkPtr> chunks);
+    void CompileInPlace(std::span<const ChunkPtr> chunks, bool is_sync);
+    void RewriteFile(std::span<const ChunkPtr> chunks, bool is_sync);
+
  public:
     ByteFileEngine() = default;
     ByteFileEngine(const ByteFileEngine& another) = delete;
@@ -26,9 +50,11 @@ class ByteFileEngine {
     ByteFileEngine& operator=(ByteFileEngine&& another) noexcept = default;
 
     ByteFileEngine(const char* file_name);
-    void InitChunks(const std::vector<std::unique_ptr<BaseChunk>>& chunks);
+    void InitChunks(std::span<const ChunkPtr> chunks);
     void ReadChunk(BaseChunk& chunk);
-    void CompileFile(const std::vector<std::unique_ptr<BaseChunk>>& chunks);
+    void CompileFile(
+        std::span<const ChunkPtr> chunks,
+        CompileMode mode = CompileMode::kAuto, bool is_sync = false);
 
     ~ByteFileEngine() = default;
 };
@@ -36,8 +62,8 @@ class ByteFileEngine {
 
 template <Hashable T = str>
 class ByteFile {
-    std::vector<std::unique_ptr<BaseChunk>> layout_;
-    std::unordered_map<T, BaseChunk*> index_;
+    std::pmr::vector<ChunkPtr> layout_;
+    std::pmr::unordered_map<T, BaseChunk*> index_;
     ByteFileEngine file_engine_;
 
     auto IsNameInIndex(const T& name) -> bool;
@@ -50,14 +76,19 @@ public:
     ByteFile<T>& operator=(ByteFile<T>&& another) = default;
 
     ByteFile(const char* file_name);
+    // Раскладка и индекс размещаются в resource. Чанки из MakeXChunk(GetResource(), ...) тоже,
+    // и вся память файла освобождается вместе с ресурсом, например monotonic_buffer_resource
+    ByteFile(const char* file_name, std::pmr::memory_resource* resource);
 
-    void AddChunk(std::unique_ptr<BaseChunk> chunk, T&& name);
-    void AddChunk(std::unique_ptr<BaseChunk> chunk, const T& name);
+    void AddChunk(ChunkPtr chunk, T&& name);
+    void AddChunk(ChunkPtr chunk, const T& name);
     BaseChunk& GetChunk(const T& name);
     BaseChunk& GetAndLoadChunk(const T& name);
 
+    [[nodiscard]] std::pmr::memory_resource* GetResource() const;
+
     void InitChunksFromFile();
-    void Compile();
+    void Compile(CompileMode mode = CompileMode::kAuto, bool is_sync = false);
 
     ~ByteFile() = default;
 };
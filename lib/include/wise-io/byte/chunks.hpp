@@ -2,12 +2,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
 #include "wise-io/schemas.hpp"
 #include "wise-io/byte/storage.hpp"
 #include "wise-io/byte/views.hpp"
+#include "wise-io/reader.hpp"
 #include "wise-io/stream.hpp"
 
 using str = std::string;
@@ -18,12 +20,15 @@ namespace wiseio {
 class BaseChunk {  // NOLINT
  public:
     virtual void Init(wiseio::Stream& stream) = 0;
+    virtual void Init(BufferedReader& reader) = 0;
     virtual void Load(wiseio::Stream& stream) = 0;
     [[nodiscard]] virtual std::vector<uint8_t> GetCompiledChunk() = 0;
     [[nodiscard]] virtual bool IsInitialized() = 0;
 
     [[nodiscard]] virtual uint64_t GetOffset() = 0;
     [[nodiscard]] virtual uint64_t GetSize() = 0;
+    [[nodiscard]] virtual uint64_t GetCompiledOffset() = 0;
+    [[nodiscard]] virtual uint64_t GetCompiledSize() = 0;
     [[nodiscard]] virtual Storage& GetStorage() = 0;
 
     virtual ~BaseChunk() = default;
@@ -37,7 +42,7 @@ class NumChunk : public BaseChunk {
     uint64_t offset_ = 0;
 
  public:
-    NumChunk(NumSize size);
+    NumChunk(NumSize size, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     NumChunk(const NumChunk& another) = delete;
     NumChunk& operator=(const NumChunk& another) = delete;
@@ -45,12 +50,15 @@ class NumChunk : public BaseChunk {
     NumChunk& operator=(NumChunk&& another) noexcept = default;
 
     void Init(Stream& stream) override;
+    void Init(BufferedReader& reader) override;
     void Load(Stream& stream) override;
     [[nodiscard]] std::vector<uint8_t> GetCompiledChunk() override;
     [[nodiscard]] bool IsInitialized() override;
 
     [[nodiscard]] uint64_t GetOffset() override;
     [[nodiscard]] uint64_t GetSize() override;
+    [[nodiscard]] uint64_t GetCompiledOffset() override;
+    [[nodiscard]] uint64_t GetCompiledSize() override;
     [[nodiscard]] Storage& GetStorage() override;
 
     ~NumChunk() override = default;
@@ -65,11 +73,13 @@ class ByteChunk : public BaseChunk {
     uint64_t size_ = 0;
     uint64_t offset_ = 0;
 
-    void SetSizeNum(NumView num);
-    [[nodiscard]] std::vector<uint8_t> GetSizeVector();
+    void SetSizeNum(NumView<std::vector<uint8_t>> num);
+    [[nodiscard]] std::vector<uint8_t> GetSizeVector(uint64_t size);
 
  public:
-    ByteChunk(NumSize size, Endianness num_endianess);
+    ByteChunk(
+        NumSize size, Endianness num_endianess,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     ByteChunk(const ByteChunk& another) = delete;
     ByteChunk& operator=(const ByteChunk& another) = delete;
@@ -77,12 +87,15 @@ class ByteChunk : public BaseChunk {
     ByteChunk& operator=(ByteChunk&& another) noexcept = default;
 
     void Init(Stream& stream) override;
+    void Init(BufferedReader& reader) override;
     void Load(Stream& stream) override;
     [[nodiscard]] std::vector<uint8_t> GetCompiledChunk() override;
     [[nodiscard]] bool IsInitialized() override;
 
     [[nodiscard]] uint64_t GetOffset() override;
     [[nodiscard]] uint64_t GetSize() override;
+    [[nodiscard]] uint64_t GetCompiledOffset() override;
+    [[nodiscard]] uint64_t GetCompiledSize() override;
     [[nodiscard]] Storage& GetStorage() override;
 
     ~ByteChunk() override = default;
@@ -99,7 +112,9 @@ class ValidateChunk : public BaseChunk {
     [[nodiscard]] bool Validate(const std::vector<uint8_t>& data) const;
 
  public:
-    ValidateChunk(size_t size, std::vector<uint8_t>&& target_value);
+    ValidateChunk(
+        size_t size, std::vector<uint8_t>&& target_value,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     ValidateChunk(const ValidateChunk& another) = delete;
     ValidateChunk& operator=(const ValidateChunk& another) = delete;
@@ -107,20 +122,47 @@ class ValidateChunk : public BaseChunk {
     ValidateChunk& operator=(ValidateChunk&& another) noexcept = default;
 
     void Init(Stream& stream) override;
+    void Init(BufferedReader& reader) override;
     void Load(Stream& stream) override;
     [[nodiscard]] std::vector<uint8_t> GetCompiledChunk() override;
     [[nodiscard]] bool IsInitialized() override;
 
     [[nodiscard]] uint64_t GetOffset() override;
     [[nodiscard]] uint64_t GetSize() override;
+    [[nodiscard]] uint64_t GetCompiledOffset() override;
+    [[nodiscard]] uint64_t GetCompiledSize() override;
     [[nodiscard]] Storage& GetStorage() override;
 
     ~ValidateChunk() override = default;
 };
 
 
+// Удаляет чанк из памяти ресурса, в котором он создан. Без ресурса работает как delete
+struct ChunkDeleter {
+    std::pmr::memory_resource* resource = nullptr;
+    size_t size = 0;
+    size_t alignment = 0;
+
+    ChunkDeleter() = default;
+    ChunkDeleter(std::default_delete<BaseChunk> /*unused*/) {}  // NOLINT(google-explicit-constructor)
+    ChunkDeleter(std::pmr::memory_resource* resource, size_t size, size_t alignment);
+
+    void operator()(BaseChunk* chunk) const;
+};
+
+using ChunkPtr = std::unique_ptr<BaseChunk, ChunkDeleter>;
+
+
 [[nodiscard]] std::unique_ptr<BaseChunk> MakeNumChunk(NumSize size);
 [[nodiscard]] std::unique_ptr<BaseChunk> MakeByteChunk(NumSize len_num_size, Endianness num_endianess = Endianness::kLittleEndian);
 [[nodiscard]] std::unique_ptr<BaseChunk> MakeValidateChunk(uint64_t size, std::vector<uint8_t>&& target_value);
 
+// Чанк и байты его хранилища размещаются в resource, например в арене ByteFile.
+// Ресурс должен жить дольше чанка
+[[nodiscard]] ChunkPtr MakeNumChunk(std::pmr::memory_resource* resource, NumSize size);
+[[nodiscard]] ChunkPtr MakeByteChunk(
+    std::pmr::memory_resource* resource, NumSize len_num_size, Endianness num_endianess = Endianness::kLittleEndian);
+[[nodiscard]] ChunkPtr MakeValidateChunk(
+    std::pmr::memory_resource* resource, uint64_t size, std::vector<uint8_t>&& target_value);
+
 } // namespace wiseio
@@ -1,10 +1,12 @@
 #pragma once  // Copyright 2025 wiserin
+#include <memory_resource>
 #include <string>
 #include <utility>
 
 #include "wise-io/byte/chunks.hpp"
 #include "wise-io/byte/bytefile.hpp"
 #include "wise-io/concepts.hpp"
+#include "wise-io/schemas.hpp"
 
 
 using str = std::string;
@@ -18,7 +20,14 @@ ByteFile<T>::ByteFile(const char* file_name)
 
 
 template <Hashable T>
-void ByteFile<T>::AddChunk(std::unique_ptr<BaseChunk> chunk, T&& name) {
+ByteFile<T>::ByteFile(const char* file_name, std::pmr::memory_resource* resource)
+        : layout_(resource)
+        , index_(resource)
+        , file_engine_(ByteFileEngine(file_name)) {}
+
+
+template <Hashable T>
+void ByteFile<T>::AddChunk(ChunkPtr chunk, T&& name) {
     if (IsNameInIndex(name)) {
         throw std::logic_error("Имя уже занято");
     }
@@ -28,7 +37,7 @@ void ByteFile<T>::AddChunk(std::unique_ptr<BaseChunk> chunk, T&& name) {
 
 
 template <Hashable T>
-void ByteFile<T>::AddChunk(std::unique_ptr<BaseChunk> chunk, const T& name) {
+void ByteFile<T>::AddChunk(ChunkPtr chunk, const T& name) {
     if (IsNameInIndex(name)) {
         throw std::logic_error("Имя уже занято");
     }
@@ -63,6 +72,12 @@ bool ByteFile<T>::IsNameInIndex(const T& name) {
 }
 
 
+template <Hashable T>
+std::pmr::memory_resource* ByteFile<T>::GetResource() const {
+    return layout_.get_allocator().resource();
+}
+
+
 template <Hashable T>
 void ByteFile<T>::InitChunksFromFile() {
     file_engine_.InitChunks(layout_);
@@ -70,8 +85,8 @@ void ByteFile<T>::InitChunksFromFile() {
 
 
 template <Hashable T>
-void ByteFile<T>::Compile() {
-    file_engine_.CompileFile(layout_);
+void ByteFile<T>::Compile(CompileMode mode, bool is_sync) {
+    file_engine_.CompileFile(layout_, mode, is_sync);
 }
 
 
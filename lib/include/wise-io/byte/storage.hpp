@@ -1,9 +1,11 @@
 #pragma once  // Copyright 2025 wiserin
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <memory_resource>
 #include <string>
-#include <vector>
 
+#include <wise-io/byte/byte_buffer.hpp>
 #include <wise-io/stream.hpp>
 
 
@@ -13,16 +15,21 @@ using str = std::string;
 namespace wiseio {
 
 class Storage {
-    std::vector<uint8_t> data_;  // TODO переписать на shared ptr
+    ByteBuffer data_;  // TODO переписать на shared ptr
     StorageState state_ = StorageState::kClean;
     Stream stream_;
 
+    static constexpr size_t kReserveThreshold = 64 * 1024;
+
     inline static std::filesystem::path cache_dir = "";
 
     void ReadFromCache();
+    void ReadRange(Stream& stream, uint64_t offset, size_t size);
 
  public:  // TODO добавить метод rollback
     Storage() = default;
+    // Байты данных выделяются из resource, он должен жить дольше хранилища
+    explicit Storage(std::pmr::memory_resource* resource);
     Storage(const Storage& another) = delete;
     Storage& operator=(const Storage& another) = delete;
     Storage(Storage&& another) noexcept = default;
@@ -31,9 +38,13 @@ class Storage {
     static void SetCacheDir(str&& path);
     void Commit();
 
-    [[nodiscard]] std::vector<uint8_t>& GetData();
+    [[nodiscard]] ByteBuffer& GetData();
+    // Заменяет данные size байтами файла с offset, как GetData помечает хранилище измененным.
+    // Меньше size, если файл короче или чтение не удалось
+    void Load(Stream& stream, uint64_t offset, size_t size);
 
     [[nodiscard]] bool IsChanged();
+    [[nodiscard]] size_t GetSize();
 
     ~Storage() = default;
 };
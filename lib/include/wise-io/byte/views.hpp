@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 
+#include <wise-io/byte/byte_buffer.hpp>
+#include <wise-io/concepts.hpp>
 #include <wise-io/schemas.hpp>
 #include <wise-io/stream.hpp>
 #include <wise-io/utils.hpp>
@@ -14,12 +16,14 @@ using str = std::string;
 
 namespace wiseio {
 
+// Buffer выводится из аргумента конструктора: std::vector<uint8_t> или ByteBuffer из Storage::GetData
+template<ByteVector Buffer = ByteBuffer>
 class NumView {  // TODO Переписать на weak
-    std::vector<uint8_t>& data_;  // NOLINT
+    Buffer& data_;  // NOLINT
     Endianness endianess_;
 
  public:
-    NumView(std::vector<uint8_t>& data, Endianness endianess = Endianness::kLittleEndian);
+    NumView(Buffer& data, Endianness endianess = Endianness::kLittleEndian);
 
     template<typename T>
     [[nodiscard]] T GetNum();
@@ -29,15 +33,24 @@ class NumView {  // TODO Переписать на weak
 };
 
 
-template <typename T>
-T NumView::GetNum() {
+template<ByteVector Buffer>
+NumView<Buffer>::NumView(Buffer& data, Endianness endianess)
+        : data_(data)
+        , endianess_(endianess) {}
+
+
+template<ByteVector Buffer>
+template<typename T>
+T NumView<Buffer>::GetNum() {
     return FromVector<T>(data_, endianess_);
 }
 
 
-template <typename T>
-void NumView::SetNum(T num) {
-    data_ = ToVector<T>(num, endianess_);
+template<ByteVector Buffer>
+template<typename T>
+void NumView<Buffer>::SetNum(T num) {
+    std::vector<uint8_t> bytes = ToVector<T>(num, endianess_);
+    data_.assign(bytes.begin(), bytes.end());
 }
 
 } // namespace wiseio
@@ -1,7 +1,9 @@
 #pragma once  // Copyright 2025 wiserin
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
+#include <vector>
 
 
 namespace wiseio {
@@ -22,4 +24,10 @@ concept Hashable =
     };
 
 
+
+// Вектор байт с любым аллокатором: std::vector<uint8_t>, ByteBuffer
+template<typename T>
+concept ByteVector = std::same_as<T, std::vector<uint8_t, typename T::allocator_type>>;
+
+
 } // namespace wiseio
@@ -2,6 +2,7 @@
 #include <bit>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -16,7 +17,7 @@ using str = std::string;
 namespace wiseio {
 
 template<Integral T>
-T FromVector(const std::vector<uint8_t>& data, wiseio::Endianness source_endian) {
+T FromVector(std::span<const uint8_t> data, wiseio::Endianness source_endian) {
     if (sizeof(T) != data.size()) {
         throw std::logic_error("Размеры не совпадают");
     }
@@ -0,0 +1,108 @@
+#pragma once  // Copyright 2025 wiserin
+#include <cstddef>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+using str = std::string;
+
+namespace wiseio {
+
+class StreamLease;
+
+
+struct StreamPoolCounters {
+    size_t hits = 0;       // Acquire отдал уже открытый стрим
+    size_t misses = 0;     // Acquire открыл файл
+    size_t evictions = 0;  // закрыто стримов по LRU или Invalidate
+};
+
+
+// Кэш открытых Stream по (путь, режим, backend) с вытеснением давно не использованных.
+// Путь в ключе берется как есть, без нормализации: "a/./b" и "a/b" дают разные стримы.
+// Все аренды одного ключа делят один Stream вместе с курсором: из нескольких потоков
+// безопасно только PRead. Пул должен пережить все выданные аренды
+class StreamPool {
+    struct Entry {
+        Stream stream;
+        std::filesystem::path path;
+        std::list<str>::iterator position;
+        size_t leases = 0;
+        bool is_stale = false;  // Invalidate при живых арендах: закроется с последней из них
+    };
+
+    size_t capacity_;
+    std::unordered_map<str, Entry> entries_;
+    std::list<str> lru_;  // в начале самые свежие ключи
+    StreamPoolCounters counters_;
+    size_t invalidations_ = 0;  // Acquire сверяет число до и после открытия файла без мьютекса
+    size_t stale_keys_ = 0;     // суффиксы ключей устаревших стримов
+    mutable std::mutex mutex_;
+
+    [[nodiscard]] static str MakeKey(const std::filesystem::path& path, OpenMode mode, IOBackend backend);
+    void Evict(size_t limit);
+    void MarkStale(std::unordered_map<str, Entry>::node_type&& node);
+    void Release(Entry* entry);
+
+    friend class StreamLease;
+
+ public:
+    static constexpr size_t kDefaultCapacity = 256;
+
+    // Если все capacity стримов арендованы, пул временно открывает больше
+    // и закрывает лишние по мере возврата аренд
+    explicit StreamPool(size_t capacity = kDefaultCapacity);
+
+    StreamPool(const StreamPool& another) = delete;
+    StreamPool& operator=(const StreamPool& another) = delete;
+    StreamPool(StreamPool&& another) = delete;
+    StreamPool& operator=(StreamPool&& another) = delete;
+
+    // Бросает std::runtime_error, если файл не удалось открыть
+    [[nodiscard]] StreamLease Acquire(
+        const std::filesystem::path& path, OpenMode mode, IOBackend backend = IOBackend::kSync);
+
+    // Закрывает стримы файла, например после ByteFile::Compile, который подменяет inode
+    void Invalidate(const std::filesystem::path& path);
+    void Clear();
+
+    [[nodiscard]] size_t GetOpenCount() const;
+    [[nodiscard]] size_t GetCapacity() const;
+    [[nodiscard]] StreamPoolCounters GetCounters() const;
+
+    ~StreamPool() = default;
+};
+
+
+// Аренда стрима из пула, возвращает его в деструкторе
+class StreamLease {
+    StreamPool* pool_ = nullptr;
+    StreamPool::Entry* entry_ = nullptr;
+
+    StreamLease(StreamPool* pool, StreamPool::Entry* entry);
+
+    friend class StreamPool;
+
+ public:
+    StreamLease() = default;
+    StreamLease(const StreamLease& another) = delete;
+    StreamLease& operator=(const StreamLease& another) = delete;
+    StreamLease(StreamLease&& another) noexcept;
+    StreamLease& operator=(StreamLease&& another) noexcept;
+
+    [[nodiscard]] Stream& Get();
+    [[nodiscard]] Stream& operator*();
+    [[nodiscard]] Stream* operator->();
+
+    void Release();
+
+    ~StreamLease();
+};
+
+} // namespace wiseio
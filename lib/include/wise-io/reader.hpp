@@ -0,0 +1,54 @@
+#pragma once  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+// Последовательное чтение поверх Stream через окно упреждающего чтения.
+// Читает по смещениям (CustomRead) и не двигает курсор стрима
+class BufferedReader {
+    Stream& stream_;  // NOLINT
+    std::unique_ptr<uint8_t[]> buffer_;  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+    size_t window_;
+    size_t capacity_ = 0;
+    size_t begin_ = 0;
+    size_t end_ = 0;
+    size_t position_;
+    size_t file_size_ = 0;
+    bool is_size_known_ = false;
+
+    [[nodiscard]] size_t GetAvailable() const;
+    [[nodiscard]] size_t GetFileEnd();
+    size_t Fill(size_t size);
+    size_t ReadDirect(std::span<uint8_t> buffer);
+
+ public:
+    static constexpr size_t kDefaultWindow = 64 * 1024;
+
+    // window == 0 отключает буферизацию: каждый запрос идет прямо в Stream
+    explicit BufferedReader(Stream& stream, size_t window = kDefaultWindow);
+    BufferedReader(Stream& stream, size_t position, size_t window);
+
+    BufferedReader(const BufferedReader& another) = delete;
+    BufferedReader& operator=(const BufferedReader& another) = delete;
+    BufferedReader(BufferedReader&& another) noexcept = default;
+    BufferedReader& operator=(BufferedReader&& another) = delete;
+
+    [[nodiscard]] std::span<const uint8_t> Peek(size_t size);
+    // Бросает std::out_of_range, если пропуск выходит за конец файла
+    size_t Skip(size_t size);
+    size_t Read(std::span<uint8_t> buffer);
+    [[nodiscard]] bool ReadExact(std::span<uint8_t> buffer);
+
+    [[nodiscard]] size_t GetPosition() const;
+    [[nodiscard]] Stream& GetStream();
+
+    ~BufferedReader() = default;
+};
+
+} // namespace wiseio
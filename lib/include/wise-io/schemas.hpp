@@ -12,6 +12,37 @@ enum class OpenMode : uint8_t {
 };
 
 
+enum class IOBackend : uint8_t {
+    kSync = 0,
+    kIOUring,
+    kMmap,
+    kDirect
+};
+
+
+enum class AccessAdvice : uint8_t {
+    kNormal = 0,
+    kSequential,
+    kRandom,
+    kWillNeed,
+    kDontNeed
+};
+
+
+enum class Durability : uint8_t {
+    kNone = 0,
+    kSyncOnClose,  // fdatasync при закрытии
+    kWriteBehind,  // фоновая запись каждые kWriteBehindWindow байт + fdatasync при закрытии
+    kFull          // fsync при закрытии, fsync файла и каталога при переименовании
+};
+
+
+enum class CompileMode : uint8_t {
+    kAuto = 0,  // на месте, если все измененные чанки сохранили размер
+    kRewrite
+};
+
+
 enum class Encoding : uint8_t {
     kUTF_8 = 1,
     kUTF_16
@@ -44,4 +75,14 @@ enum class Endianness : uint8_t {
 };
 
 
+enum class StreamError : uint8_t {
+    kNone = 0,
+    kOpen,         // не удалось открыть файл
+    kClosed,       // обращение через закрытый fd
+    kWrongMode,    // метод недоступен в режиме открытия
+    kWrongState,   // метод недоступен для backend или состояния стрима
+    kIO            // ошибка записи в ядре, чтения сообщают о ней через -1
+};
+
+
 } // namespace wiseio
@@ -1,34 +1,130 @@
 #pragma once  // Copyright 2025 wiserin
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <expected>
 #include <filesystem>
+#include <memory>
+#include <span>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "logging/logger.hpp"
+#include "wise-io/byte/byte_buffer.hpp"
 #include "wise-io/schemas.hpp"
 
 
 using stat_t = struct stat;
 using str = std::string;
 
+struct wcore_uring;
+
 namespace wiseio {
 
 class IOBuffer;
+class AsyncIO;
+class Reactor;
+
+
+struct ReadSegment {
+    std::span<uint8_t> buffer;  // после чтения обрезается до реально прочитанных байт
+    size_t offset = 0;
+};
+
+
+struct WriteSegment {
+    std::span<const uint8_t> buffer;
+    size_t offset = 0;
+};
+
+
+// Разбиение ReadAll на диапазоны, которые читаются параллельно
+struct ParallelReadOptions {
+    size_t split_size = 8 * 1024 * 1024;  // округляется вверх до 4096
+    size_t workers = 4;                   // потоков вместе с вызывающим
+};
+
+
+// Число байт или причина ошибки: errno для kIO/kOpen, иначе StreamError
+using IOResult = std::expected<size_t, std::error_code>;
+
+
+struct StreamCounters {
+    size_t stat_calls = 0;    // fstat, выполненные этим стримом
+    size_t cursor_moves = 0;  // вызовы SetCursor
+    size_t readahead_hints = 0;  // подсказки WILLNEED, выданные CRead
+};
+
 
 class Stream {  // TODO добавить перегрузку << 
+    static constexpr size_t kReadAheadWindow = 2 * 1024 * 1024;
+    static constexpr size_t kCopyBufferSize = 1024 * 1024;
+    static constexpr size_t kWriteBehindWindow = 8 * 1024 * 1024;
+
+    // Кольцо io_uring и отображение mmap. Выделяется только для этих backend,
+    // стрим kSync и kDirect держит вместо них один нулевой указатель
+    struct BackendState {
+        wcore_uring* ring = nullptr;
+        uint8_t* map_data = nullptr;
+        size_t map_size = 0;
+
+        BackendState() = default;
+        BackendState(const BackendState& another) = delete;
+        BackendState& operator=(const BackendState& another) = delete;
+        ~BackendState();  // закрывает кольцо и снимает отображение
+    };
+
     int fd_ = -1;
     bool is_eof_ = false;
+    bool is_anonymous_ = false;  // O_TMPFILE, file_path_ указывает на каталог
+    bool is_scratch_ = false;    // именованная замена O_TMPFILE: удаляется при закрытии, если его не забрал Rename
     OpenMode mode_ = OpenMode::kDefault;
+    IOBackend backend_ = IOBackend::kSync;
+    Durability durability_ = Durability::kNone;
+    AccessAdvice advice_ = AccessAdvice::kNormal;  // последний режим доступа ко всему файлу
+    std::unique_ptr<BackendState> backend_state_;
     size_t cursor_ = 0;  // TODO переписать на uint64_t
+    size_t readahead_until_ = 0;
+    // Атомарны, потому что асинхронные записи учитываются в потоках реактора
+    std::atomic<size_t> unsynced_size_ = 0;
+    std::atomic<size_t> file_size_ = 0;  // fstat при открытии, дальше растет вместе с записями
+    mutable StreamCounters counters_;
+    mutable StreamError last_error_ = StreamError::kNone;
+    mutable int last_errno_ = 0;
     std::filesystem::path file_path_;
-    logging::Logger logger_;
+    const logging::Logger* logger_ = nullptr;  // не владеет, nullptr отключает логирование
+
+    inline static std::atomic<const logging::Logger*> default_logger = nullptr;
+    inline static std::atomic<bool> is_default_logger_set = false;
 
     bool Open();
+    void InitBackend();
+    void ReleaseBackend();
+    void DropScratch();
 
     void FdCheck() const;
+    [[gnu::cold]] void ReportError(StreamError error, const str& message) const;
+    [[gnu::cold]] void LogFallback(const str& message) const;
+    [[gnu::cold]] void RecordIOError() const;
+    ssize_t CorePRead(std::span<uint8_t> buffer, size_t offset) const;
+
+    void AdviseReadAhead(size_t buffer_size);
+    // Вызываются и из потоков реактора. При kWriteBehind запись, пересекшая окно, сама
+    // ждет предыдущий сброс и запускает новый (sync_file_range) - синхронно, в своем потоке
+    void TrackWrite(size_t offset, size_t size);
+    void TrackAppend(size_t size);
+    void SyncOnClose();
 
-    Stream(OpenMode mode, const char* file_name);
+    ssize_t CoreCRead(uint8_t* buffer, size_t buffer_size);
+    ssize_t CoreReadAll(uint8_t* buffer, size_t f_size);
+    ssize_t CoreReadAllParallel(uint8_t* buffer, size_t f_size, const ParallelReadOptions& options);
+    ssize_t CoreCustomRead(uint8_t* buffer, size_t offset, size_t buffer_size);
+    bool CoreCWrite(const uint8_t* buffer, size_t buffer_size);
+    bool CoreCustomWrite(const uint8_t* buffer, size_t offset, size_t buffer_size);  // NOLINT(modernize-use-nodiscard)
+    bool CoreAWrite(const uint8_t* buffer, size_t buffer_size);
+
+    Stream(OpenMode mode, const char* file_name, IOBackend backend);
 
  public:
     Stream() = default;
@@ -41,44 +137,123 @@ class Stream {  // TODO добавить перегрузку <<
     ssize_t CRead(std::vector<uint8_t>& buffer);
     ssize_t CRead(IOBuffer& buffer);
     ssize_t CRead(str& buffer);
+    ssize_t CRead(std::span<uint8_t> buffer);
+    ssize_t CRead(std::span<std::byte> buffer);
     ssize_t CustomRead(std::vector<uint8_t>& buffer, size_t offset);
     ssize_t CustomRead(IOBuffer& buffer, size_t offset);
     ssize_t CustomRead(str& buffer, size_t offset);
+    ssize_t CustomRead(std::span<uint8_t> buffer, size_t offset);
+    ssize_t CustomRead(std::span<std::byte> buffer, size_t offset);
+    ssize_t CustomRead(std::vector<ReadSegment>& segments);
+    // Позиционное чтение без общего состояния: можно вызывать из нескольких потоков.
+    // Короткий ответ означает конец файла только для этого вызова
+    ssize_t PRead(std::span<uint8_t> buffer, size_t offset) const;
+    ssize_t PRead(std::span<std::byte> buffer, size_t offset) const;
     ssize_t ReadAll(std::vector<uint8_t>& buffer);
     ssize_t ReadAll(IOBuffer& buffer);
     ssize_t ReadAll(str& buffer);
+    // Файл меньше двух диапазонов читается обычным ReadAll
+    ssize_t ReadAll(std::vector<uint8_t>& buffer, const ParallelReadOptions& options);
+    ssize_t ReadAll(IOBuffer& buffer, const ParallelReadOptions& options);
+    ssize_t ReadAll(str& buffer, const ParallelReadOptions& options);
+
+    // Варианты без перегрузок под контейнеры: ошибка возвращается вместе с errno, исключений нет
+    IOResult TryCRead(std::span<uint8_t> buffer);
+    IOResult TryCustomRead(std::span<uint8_t> buffer, size_t offset);
+    IOResult TryPRead(std::span<uint8_t> buffer, size_t offset) const;
+    IOResult TryCWrite(std::span<const uint8_t> buffer);
+    IOResult TryAWrite(std::span<const uint8_t> buffer);
+    IOResult TryCustomWrite(std::span<const uint8_t> buffer, size_t offset);
+
+    // Ожидаемые через co_await версии CustomRead, CustomWrite, ReadAll и AWrite, см. wise-io/async.hpp.
+    // reactor == nullptr означает Reactor::GetDefault(). Чтения, как PRead, не трогают курсор и EOF
+    // и могут ожидаться параллельно. Записи обновляют размер файла при возобновлении корутины
+    [[nodiscard]] AsyncIO AsyncRead(std::span<uint8_t> buffer, size_t offset, Reactor* reactor = nullptr) const;
+    // ByteBuffer и строка растут до размера файла без обнуления, std::vector<uint8_t> обнуляется при росте
+    [[nodiscard]] AsyncIO AsyncReadAll(std::vector<uint8_t>& buffer, Reactor* reactor = nullptr) const;
+    [[nodiscard]] AsyncIO AsyncReadAll(ByteBuffer& buffer, Reactor* reactor = nullptr) const;
+    [[nodiscard]] AsyncIO AsyncReadAll(str& buffer, Reactor* reactor = nullptr) const;
+    [[nodiscard]] AsyncIO AsyncWrite(std::span<const uint8_t> buffer, size_t offset, Reactor* reactor = nullptr);
+    [[nodiscard]] AsyncIO AsyncAWrite(std::span<const uint8_t> buffer, Reactor* reactor = nullptr);
 
     bool AWrite(const std::vector<uint8_t>& buffer);
     bool AWrite(const IOBuffer& buffer);
     bool AWrite(const str& buffer);
+    bool AWrite(std::span<const uint8_t> buffer);
+    bool AWrite(std::span<const std::byte> buffer);
+    bool AWrite(const std::vector<std::span<const uint8_t>>& buffers);
     bool CWrite(const std::vector<uint8_t>& buffer);
     bool CWrite(const IOBuffer& buffer);
     bool CWrite(const str& buffer);
-    bool CustomWrite(const std::vector<uint8_t>& buffer, size_t offset) const;  // NOLINT(modernize-use-nodiscard)
-    bool CustomWrite(const IOBuffer& buffer, size_t offset) const;  // NOLINT(modernize-use-nodiscard)
-    bool CustomWrite(const str& buffer, size_t offset) const;  // NOLINT(modernize-use-nodiscard)
+    bool CWrite(std::span<const uint8_t> buffer);
+    bool CWrite(std::span<const std::byte> buffer);
+    bool CustomWrite(const std::vector<uint8_t>& buffer, size_t offset);  // NOLINT(modernize-use-nodiscard)
+    bool CustomWrite(const IOBuffer& buffer, size_t offset);  // NOLINT(modernize-use-nodiscard)
+    bool CustomWrite(const str& buffer, size_t offset);  // NOLINT(modernize-use-nodiscard)
+    bool CustomWrite(std::span<const uint8_t> buffer, size_t offset);  // NOLINT(modernize-use-nodiscard)
+    bool CustomWrite(std::span<const std::byte> buffer, size_t offset);  // NOLINT(modernize-use-nodiscard)
+    bool CustomWrite(const std::vector<WriteSegment>& segments);  // NOLINT(modernize-use-nodiscard)
+    bool CopyRange(Stream& destination, size_t offset, size_t size, size_t destination_offset);  // NOLINT(modernize-use-nodiscard)
+
+    bool Advise(AccessAdvice advice, size_t offset = 0, size_t size = 0);  // NOLINT(modernize-use-nodiscard)
+    bool Reserve(size_t size);  // NOLINT(modernize-use-nodiscard)
+    bool Sync();  // NOLINT(modernize-use-nodiscard)
+    void SetDurability(Durability durability);
 
     void SetCursor(size_t position);
 
     [[nodiscard]] size_t GetCursor() const;
     [[nodiscard]] size_t GetFileSize() const;
-    void SetDelete() const;
+    size_t RefreshFileSize();  // NOLINT(modernize-use-nodiscard)
+    [[nodiscard]] const StreamCounters& GetCounters() const;
+    void SetDelete();
 
     [[nodiscard]] bool IsEOF() const;
     [[nodiscard]] bool IsOpen() const;
+    [[nodiscard]] bool IsAnonymous() const;
+    [[nodiscard]] OpenMode GetMode() const;
+    [[nodiscard]] IOBackend GetBackend() const;
+    [[nodiscard]] Durability GetDurability() const;
+    [[nodiscard]] AccessAdvice GetAdvice() const;
+    [[nodiscard]] StreamError GetLastError() const;
+    [[nodiscard]] std::error_code GetErrorCode() const;
+    void ClearError();
+    void SetLogger(const logging::Logger* logger);
+
+    // Логгер для стримов, открытых после вызова. По умолчанию все стримы делят GetSharedLogger()
+    static void SetDefaultLogger(const logging::Logger* logger);
+    [[nodiscard]] static const logging::Logger* GetDefaultLogger();
+    [[nodiscard]] static const logging::Logger& GetSharedLogger();
+    [[nodiscard]] std::span<const uint8_t> GetMappedView(
+        size_t offset = 0, size_t size = SIZE_MAX) const;
 
     void Rename(str&& new_name);
+    bool Link(const std::filesystem::path& path);  // NOLINT(modernize-use-nodiscard)
     void Close();
 
-    friend Stream CreateStream(const char* name, OpenMode mode, bool is_temp);
-    friend Stream CreateStream(const std::filesystem::path& name, OpenMode mode, bool is_temp);
+    friend Stream CreateStream(const char* name, OpenMode mode, bool is_temp, IOBackend backend);
+    friend Stream CreateStream(const std::filesystem::path& name, OpenMode mode, bool is_temp, IOBackend backend);
+    friend Stream CreateTempStream(const std::filesystem::path& dir, IOBackend backend);
+    friend class AsyncIO;
 
     ~Stream();
 };
 
 
-[[nodiscard]] Stream CreateStream(const char* name, OpenMode mode, bool is_temp = false);
-[[nodiscard]] Stream CreateStream(const std::filesystem::path& name, OpenMode mode, bool is_temp = false);
+[[nodiscard]] Stream CreateStream(
+    const char* name, OpenMode mode, bool is_temp = false, IOBackend backend = IOBackend::kSync);
+[[nodiscard]] Stream CreateStream(
+    const std::filesystem::path& name, OpenMode mode, bool is_temp = false, IOBackend backend = IOBackend::kSync);
+[[nodiscard]] Stream CreateTempStream(
+    const std::filesystem::path& dir, IOBackend backend = IOBackend::kSync);
+
+
+[[nodiscard]] const std::error_category& StreamCategory();
+[[nodiscard]] std::error_code make_error_code(StreamError error);  // NOLINT(readability-identifier-naming)
 
 
 } // namespace wiseio
+
+
+template<>
+struct std::is_error_code_enum<wiseio::StreamError> : std::true_type {};
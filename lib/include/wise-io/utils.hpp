@@ -1,5 +1,7 @@
 #pragma once  // Copyright 2025 wiserin
+#include <atomic>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -13,7 +15,7 @@ using str = std::string;
 namespace wiseio {
 
 template<Integral T>
-[[nodiscard]] T FromVector(const std::vector<uint8_t>& data, wiseio::Endianness source_endian);
+[[nodiscard]] T FromVector(std::span<const uint8_t> data, wiseio::Endianness source_endian);
 
 
 template<Integral T>
@@ -21,7 +23,7 @@ template<Integral T>
 
 
 class FileNamer {
-    inline static uint64_t current = 0;
+    inline static std::atomic<uint64_t> current = 0;
 
  public:
     [[nodiscard]] static str GetName();
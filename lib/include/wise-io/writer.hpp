@@ -0,0 +1,67 @@
+#pragma once  // Copyright 2025 wiserin
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+
+#include "wise-io/buffer.hpp"
+#include "wise-io/stream.hpp"
+
+
+using str = std::string;
+
+namespace wiseio {
+
+// Склеивает мелкие записи в Stream в крупные выровненные сбросы.
+// Пишет через AWrite для режима Append и через CWrite для остальных.
+// Пока writer жив, писать в Stream напрямую нельзя
+class BufferedWriter {
+    Stream& stream_;  // NOLINT
+    AlignedIOBuffer active_;
+    AlignedIOBuffer pending_;
+    size_t capacity_;
+    size_t filled_ = 0;  // занято в active_, размер буфера выставляется только перед сбросом
+    bool is_async_;
+    std::atomic<bool> is_failed_ = false;
+
+    // Состояние фонового сброса, защищено mutex_
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread worker_;
+    bool is_pending_ = false;
+    bool is_stopped_ = false;
+
+    bool WriteOut(std::span<const uint8_t> buffer);
+    bool FlushActive();
+    bool WaitPending();
+    void Worker();
+
+ public:
+    static constexpr size_t kDefaultCapacity = 1024 * 1024;
+
+    // capacity округляется вверх до кратного AlignedIOBuffer::kDefaultAlignment.
+    // is_async == true отдает заполненные буферы фоновому потоку
+    explicit BufferedWriter(Stream& stream, size_t capacity = kDefaultCapacity, bool is_async = false);
+
+    BufferedWriter(const BufferedWriter& another) = delete;
+    BufferedWriter& operator=(const BufferedWriter& another) = delete;
+    BufferedWriter(BufferedWriter&& another) = delete;
+    BufferedWriter& operator=(BufferedWriter&& another) = delete;
+
+    // Ошибка сброса запоминается: все последующие Write и Flush возвращают false
+    bool Write(std::span<const uint8_t> buffer);
+    bool Write(const str& buffer);
+    bool Flush();  // NOLINT(modernize-use-nodiscard)
+
+    [[nodiscard]] size_t GetBuffered() const;
+    [[nodiscard]] size_t GetCapacity() const;
+    [[nodiscard]] Stream& GetStream();
+
+    ~BufferedWriter();
+};
+
+} // namespace wiseio
@@ -0,0 +1,105 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "wise-io/buffer.hpp"
+
+
+namespace wiseio {
+
+AlignedIOBuffer::AlignedIOBuffer(size_t alignment)
+        : alignment_(alignment) {
+
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument("Выравнивание должно быть степенью двойки");
+    }
+}
+
+
+AlignedIOBuffer::AlignedIOBuffer(AlignedIOBuffer&& another) noexcept
+        : data_(std::exchange(another.data_, nullptr))
+        , size_(std::exchange(another.size_, 0))
+        , capacity_(std::exchange(another.capacity_, 0))
+        , alignment_(another.alignment_) {}
+
+
+AlignedIOBuffer& AlignedIOBuffer::operator=(AlignedIOBuffer&& another) noexcept {
+    if (this != &another) {
+        Release();
+        data_ = std::exchange(another.data_, nullptr);
+        size_ = std::exchange(another.size_, 0);
+        capacity_ = std::exchange(another.capacity_, 0);
+        alignment_ = another.alignment_;
+    }
+    return *this;
+}
+
+
+uint8_t* AlignedIOBuffer::GetDataPtr() {
+    return data_;
+}
+
+
+const uint8_t* AlignedIOBuffer::GetDataPtr() const {
+    return data_;
+}
+
+
+size_t AlignedIOBuffer::GetBufferSize() const {
+    return size_;
+}
+
+
+size_t AlignedIOBuffer::GetCapacity() const {
+    return capacity_;
+}
+
+
+size_t AlignedIOBuffer::GetAlignment() const {
+    return alignment_;
+}
+
+
+size_t AlignedIOBuffer::RoundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+
+void AlignedIOBuffer::ResizeBuffer(size_t size) {
+    if (size <= capacity_) {
+        size_ = size;
+        return;
+    }
+
+    size_t capacity = RoundUp(size, alignment_);
+    auto* data = static_cast<uint8_t*>(::operator new(capacity, std::align_val_t(alignment_)));
+    if (size_ > 0) {
+        std::memcpy(data, data_, size_);
+    }
+    Release();
+
+    data_ = data;
+    size_ = size;
+    capacity_ = capacity;
+}
+
+
+void AlignedIOBuffer::Release() {
+    if (data_ != nullptr) {
+        ::operator delete(data_, std::align_val_t(alignment_));
+    }
+    data_ = nullptr;
+    capacity_ = 0;
+}
+
+
+AlignedIOBuffer::~AlignedIOBuffer() {
+    Release();
+}
+
+
+
+} // namespase wiseio
@@ -0,0 +1,216 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "wise-io/buffer_pool.hpp"
+
+
+namespace wiseio {
+
+namespace {
+
+using Bucket = std::vector<std::vector<uint8_t>>;
+
+constexpr size_t kNoClass = BufferPool::kClassCount;
+constexpr size_t kThreadCacheDepth = 8;  // буферов одного класса в кэше потока
+
+
+constexpr size_t GetClassSize(size_t index) {
+    return size_t{1} << (index + BufferPool::kMinClassShift);
+}
+
+
+// Класс, буферы которого вмещают size байт
+size_t GetAcquireClass(size_t size) {
+    if (size <= GetClassSize(0)) {
+        return 0;
+    }
+    size_t index = std::bit_width(size - 1) - BufferPool::kMinClassShift;
+    return index < BufferPool::kClassCount ? index : kNoClass;
+}
+
+
+// Наибольший класс, который гарантирует буфер емкостью capacity
+size_t GetReleaseClass(size_t capacity) {
+    if (capacity < GetClassSize(0) || capacity > GetClassSize(BufferPool::kClassCount - 1)) {
+        return kNoClass;
+    }
+    return std::bit_width(capacity) - 1 - BufferPool::kMinClassShift;
+}
+
+
+struct SharedBucket {
+    std::mutex mutex;
+    Bucket buffers;
+};
+
+constinit std::array<SharedBucket, BufferPool::kClassCount> shared_buckets;
+
+constinit std::atomic<size_t> allocations_count{0};
+constinit std::atomic<size_t> shared_hits_count{0};
+constinit std::atomic<size_t> dropped_count{0};
+constinit std::atomic<size_t> shared_bytes{0};
+
+
+// Место в общем бюджете резервируется до захвата мьютекса класса
+bool PushShared(size_t index, std::vector<uint8_t>&& buffer) {
+    size_t size = GetClassSize(index);
+    size_t used = shared_bytes.load(std::memory_order_relaxed);
+    do {
+        if (used + size > BufferPool::kSharedBytes) {
+            return false;
+        }
+    } while (!shared_bytes.compare_exchange_weak(used, used + size, std::memory_order_relaxed));
+
+    SharedBucket& bucket = shared_buckets[index];
+    std::lock_guard lock(bucket.mutex);
+    bucket.buffers.push_back(std::move(buffer));
+    return true;
+}
+
+
+std::vector<uint8_t> PopShared(size_t index) {
+    std::vector<uint8_t> buffer;
+    SharedBucket& bucket = shared_buckets[index];
+    {
+        std::lock_guard lock(bucket.mutex);
+        if (bucket.buffers.empty()) {
+            return buffer;
+        }
+        buffer = std::move(bucket.buffers.back());
+        bucket.buffers.pop_back();
+    }
+    shared_bytes.fetch_sub(GetClassSize(index), std::memory_order_relaxed);
+    return buffer;
+}
+
+
+// Кэш потока отдает буферы в общий запас при завершении потока
+struct ThreadCache {
+    std::array<Bucket, BufferPool::kClassCount> buckets;
+    size_t bytes = 0;
+
+    ~ThreadCache();
+};
+
+// Тривиально разрушаемый флаг: после разрушения кэша поток работает только с общим запасом
+constinit thread_local bool is_cache_destroyed = false;
+
+
+ThreadCache::~ThreadCache() {
+    is_cache_destroyed = true;
+    for (size_t index = 0; index < buckets.size(); ++index) {
+        for (std::vector<uint8_t>& buffer : buckets[index]) {
+            if (!PushShared(index, std::move(buffer))) {
+                dropped_count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+
+ThreadCache* GetThreadCache() {
+    if (is_cache_destroyed) {
+        return nullptr;
+    }
+    thread_local ThreadCache cache;
+    return &cache;
+}
+
+} // namespace
+
+
+std::vector<uint8_t> BufferPool::Acquire(size_t size) {
+    size_t index = GetAcquireClass(size);
+    std::vector<uint8_t> buffer;
+    if (index == kNoClass) {
+        allocations_count.fetch_add(1, std::memory_order_relaxed);
+        buffer.reserve(size);
+        return buffer;
+    }
+
+    ThreadCache* cache = GetThreadCache();
+    if (cache != nullptr && !cache->buckets[index].empty()) {
+        buffer = std::move(cache->buckets[index].back());
+        cache->buckets[index].pop_back();
+        cache->bytes -= GetClassSize(index);
+        return buffer;
+    }
+
+    buffer = PopShared(index);
+    if (buffer.capacity() != 0) {
+        shared_hits_count.fetch_add(1, std::memory_order_relaxed);
+        return buffer;
+    }
+
+    allocations_count.fetch_add(1, std::memory_order_relaxed);
+    buffer.reserve(GetClassSize(index));
+    return buffer;
+}
+
+
+void BufferPool::Release(std::vector<uint8_t>&& buffer) {
+    std::vector<uint8_t> released = std::move(buffer);
+    size_t index = GetReleaseClass(released.capacity());
+    if (index == kNoClass) {
+        return;
+    }
+    released.clear();
+
+    ThreadCache* cache = GetThreadCache();
+    if (cache != nullptr && cache->buckets[index].size() < kThreadCacheDepth
+            && cache->bytes + GetClassSize(index) <= kThreadCacheBytes) {
+        cache->buckets[index].push_back(std::move(released));
+        cache->bytes += GetClassSize(index);
+        return;
+    }
+    if (!PushShared(index, std::move(released))) {
+        dropped_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+
+void BufferPool::Reserve(std::vector<uint8_t>& buffer, size_t size) {
+    if (size <= buffer.capacity()) {
+        return;
+    }
+    std::vector<uint8_t> grown = Acquire(std::max(size, buffer.capacity() * 2));
+    grown.assign(buffer.begin(), buffer.end());
+    Release(std::exchange(buffer, std::move(grown)));
+}
+
+
+void BufferPool::Trim() {
+    ThreadCache* cache = GetThreadCache();
+    if (cache != nullptr) {
+        for (Bucket& bucket : cache->buckets) {
+            Bucket().swap(bucket);
+        }
+        cache->bytes = 0;
+    }
+    for (size_t index = 0; index < shared_buckets.size(); ++index) {
+        Bucket released;
+        {
+            std::lock_guard lock(shared_buckets[index].mutex);
+            released.swap(shared_buckets[index].buffers);
+        }
+        shared_bytes.fetch_sub(released.size() * GetClassSize(index), std::memory_order_relaxed);
+    }
+}
+
+
+BufferPoolCounters BufferPool::GetCounters() {
+    return {
+        allocations_count.load(std::memory_order_relaxed),
+        shared_hits_count.load(std::memory_order_relaxed),
+        dropped_count.load(std::memory_order_relaxed),
+        shared_bytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace wiseio
@@ -1,10 +1,15 @@
-#include <cstddef>  // Copyright 2025 wiserin
+#include <algorithm>  // Copyright 2025 wiserin
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "wise-io/buffer.hpp"
+#include "wise-io/buffer_pool.hpp"
 
 
 namespace wiseio {
@@ -25,6 +30,7 @@ size_t BytesIOBuffer::GetBufferSize() const {
 
 
 void BytesIOBuffer::ResizeBuffer(size_t size) {
+    BufferPool::Reserve(data_, size);
     data_.resize(size);
 }
 
@@ -49,32 +55,53 @@ bool BytesIOBuffer::IsData() const {
 }
 
 
+// Курсор может оказаться за концом после ResizeBuffer с уменьшением
+size_t BytesIOBuffer::GetAvailable(size_t size) const {
+    if (cursor_ >= data_.size()) {
+        return 0;
+    }
+    return std::min(size, data_.size() - cursor_);
+}
+
+
 std::vector<uint8_t> BytesIOBuffer::ReadFromBuffer(size_t size) {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(128);
+    std::span<const uint8_t> slice = Slice(size);
+    return {slice.begin(), slice.end()};
+}
 
-    while (size > 0 && cursor_ < data_.size()) {
-        buffer.push_back(data_[cursor_]);
-        ++cursor_;
-        --size;
+
+size_t BytesIOBuffer::ReadFromBuffer(std::span<uint8_t> destination) {
+    std::span<const uint8_t> slice = Slice(destination.size());
+    if (!slice.empty()) {
+        std::memcpy(destination.data(), slice.data(), slice.size());
     }
+    return slice.size();
+}
 
-    return buffer;
+
+std::span<const uint8_t> BytesIOBuffer::Slice(size_t size) {
+    size_t count = GetAvailable(size);
+    std::span<const uint8_t> slice(data_.data() + cursor_, count);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    cursor_ += count;
+    return slice;
 }
 
 
 void BytesIOBuffer::AddDataToBuffer(const std::vector<uint8_t>& data) {
+    BufferPool::Reserve(data_, data_.size() + data.size());
     data_.insert(data_.end(), data.begin(), data.end());
 }
 
 
+// Память возвращается в пул, чтобы следующий буфер того же размера не выделял ее заново
 void BytesIOBuffer::Clear() {
-    data_.resize(0);
-    data_.shrink_to_fit();
-    data_.reserve(128);
+    BufferPool::Release(std::exchange(data_, {}));
     cursor_ = 0;
 }
 
 
+BytesIOBuffer::~BytesIOBuffer() {
+    BufferPool::Release(std::move(data_));
+}
 
 } // namespase wiseio
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "wise-io/buffer.hpp"
+
+
+namespace wiseio {
+
+RingIOBuffer::RingIOBuffer(size_t capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Емкость кольцевого буфера должна быть больше нуля");
+    }
+    data_.resize(capacity);
+}
+
+
+RingIOBuffer::RingIOBuffer(RingIOBuffer&& another) noexcept
+        : data_(std::exchange(another.data_, {}))
+        , head_(std::exchange(another.head_, 0))
+        , size_(std::exchange(another.size_, 0)) {}
+
+
+RingIOBuffer& RingIOBuffer::operator=(RingIOBuffer&& another) noexcept {
+    if (this != &another) {
+        data_ = std::exchange(another.data_, {});
+        head_ = std::exchange(another.head_, 0);
+        size_ = std::exchange(another.size_, 0);
+    }
+    return *this;
+}
+
+
+size_t RingIOBuffer::GetTail() const {
+    size_t tail = head_ + size_;
+    return tail >= data_.size() ? tail - data_.size() : tail;
+}
+
+
+size_t RingIOBuffer::GetWriteWindowSize() const {
+    if (size_ == data_.size()) {
+        return 0;
+    }
+    size_t tail = GetTail();
+    return tail >= head_ ? data_.size() - tail : head_ - tail;
+}
+
+
+std::span<uint8_t> RingIOBuffer::GetWriteWindow() {
+    return {data_.data() + GetTail(), GetWriteWindowSize()};  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+void RingIOBuffer::CommitWrite(size_t size) {
+    if (size > GetWriteWindowSize()) {
+        throw std::out_of_range(
+            "Записано больше, чем помещается в окно записи. Запрошено: "
+            + std::to_string(size) + " размер окна: " + std::to_string(GetWriteWindowSize()));
+    }
+    size_ += size;
+}
+
+
+std::span<const uint8_t> RingIOBuffer::GetReadWindow() const {
+    return {data_.data() + head_, std::min(size_, data_.size() - head_)};  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// Опустевший буфер начинается с нуля, чтобы следующее окно записи было максимальным
+void RingIOBuffer::Consume(size_t size) {
+    if (size > size_) {
+        throw std::out_of_range(
+            "Запрошено больше данных, чем есть в буфере. Запрошено: "
+            + std::to_string(size) + " в буфере: " + std::to_string(size_));
+    }
+    size_ -= size;
+    head_ = size_ == 0 ? 0 : (head_ + size) % data_.size();
+}
+
+
+size_t RingIOBuffer::Write(std::span<const uint8_t> data) {
+    size_t written = 0;
+    while (written < data.size() && !IsFull()) {
+        std::span<uint8_t> window = GetWriteWindow();
+        size_t count = std::min(window.size(), data.size() - written);
+        std::memcpy(window.data(), data.data() + written, count);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        size_ += count;
+        written += count;
+    }
+    return written;
+}
+
+
+size_t RingIOBuffer::Read(std::span<uint8_t> destination) {
+    size_t read = 0;
+    while (read < destination.size() && !IsEmpty()) {
+        std::span<const uint8_t> window = GetReadWindow();
+        size_t count = std::min(window.size(), destination.size() - read);
+        std::memcpy(destination.data() + read, window.data(), count);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        Consume(count);
+        read += count;
+    }
+    return read;
+}
+
+
+size_t RingIOBuffer::GetSize() const {
+    return size_;
+}
+
+
+size_t RingIOBuffer::GetFree() const {
+    return data_.size() - size_;
+}
+
+
+size_t RingIOBuffer::GetCapacity() const {
+    return data_.size();
+}
+
+
+bool RingIOBuffer::IsEmpty() const {
+    return size_ == 0;
+}
+
+
+bool RingIOBuffer::IsFull() const {
+    return size_ == data_.size();
+}
+
+
+void RingIOBuffer::Clear() {
+    head_ = 0;
+    size_ = 0;
+}
+
+} // namespace wiseio
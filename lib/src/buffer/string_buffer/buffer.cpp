@@ -2,6 +2,7 @@
 #include <cstdint>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "wise-io/buffer.hpp"
@@ -71,13 +72,13 @@ bool StringIOBuffer::IsLines() const {
 
 
 str StringIOBuffer::GetLine() {
-    std::vector<char> buffer = ReadLine();
+    std::string_view line = ReadLine();
 
-    while (!Validate(buffer) && IsLines()) {
-        buffer = ReadLine();
+    while (!Validate(line) && IsLines()) {
+        line = ReadLine();
     }
 
-    return str(buffer.data(), buffer.size());
+    return str(line);
 }
 
 
@@ -86,10 +87,14 @@ void StringIOBuffer::AddDataToBuffer(const str& data) {
 }
 
 
+// Небольшая емкость сохраняется для повторного заполнения, большая освобождается
 void StringIOBuffer::Clear() {
-    data_.resize(0);
-    data_.shrink_to_fit();
-    data_.reserve(128);
+    constexpr size_t kKeepCapacity = 64 * 1024;
+    data_.clear();
+    if (data_.capacity() > kKeepCapacity) {
+        std::vector<char>().swap(data_);
+        data_.reserve(128);
+    }
     cursor_ = 0;
 }
 
@@ -1,5 +1,6 @@
 #include <cstddef>  // Copyright 2025 wiserin
-#include <vector>
+#include <cstring>
+#include <string_view>
 
 #include "wise-io/buffer.hpp"
 
@@ -7,24 +8,19 @@
 namespace wiseio {
 
 
-std::vector<char> StringIOBuffer::ReadLine() {
+// Перевод строки ищется через memchr: glibc сканирует векторно (SSE2/AVX2), а не побайтно
+std::string_view StringIOBuffer::ReadLine() {
     if (cursor_ >= data_.size()) {
-        return std::vector<char>();
+        return {};
     }
-    std::vector<char> buffer;
-    buffer.reserve(128);
+    const char* begin = data_.data() + cursor_;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    size_t rest = data_.size() - cursor_;
+    const void* found = std::memchr(begin, '\n', rest);
 
-    while (cursor_ < data_.size() && data_[cursor_] != '\n') {
-        buffer.push_back(data_[cursor_]);
-        ++cursor_;
-    }
-
-    if (cursor_ < data_.size() && data_[cursor_] == '\n') {
-        ++cursor_;
-    }
-
-    return buffer;
+    size_t len = found == nullptr ? rest : static_cast<size_t>(static_cast<const char*>(found) - begin);
+    cursor_ += found == nullptr ? len : len + 1;
+    return {begin, len};
 }
 
 
-} // namespase wiseio
\ No newline at end of file
+} // namespase wiseio
@@ -1,6 +1,6 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <cctype>
-#include <vector>
+#include <string_view>
 
 #include "wise-io/buffer.hpp"
 
@@ -8,7 +8,7 @@
 namespace wiseio {
 
 
-bool StringIOBuffer::Validate(std::vector<char>& line) const {
+bool StringIOBuffer::Validate(std::string_view& line) const {
     if (ignore_blank_) {
         if (IsBlank(line)) {
             return false;
@@ -24,7 +24,7 @@ bool StringIOBuffer::Validate(std::vector<char>& line) const {
 
 
 
-bool StringIOBuffer::IsBlank(const std::vector<char>& line) const {
+bool StringIOBuffer::IsBlank(std::string_view line) const {
     for (unsigned char el : line) {
         if (!std::isspace(el)) {
             return false;
@@ -34,48 +34,26 @@ bool StringIOBuffer::IsBlank(const std::vector<char>& line) const {
 }
 
 
-void StringIOBuffer::DeleteComment(std::vector<char>& line) const {
-    std::vector<char> temp;
-
-    for (char el : line) {
-        if (el == '\0') {
-            break;
-        } else {
-            temp.push_back(el);
-        }
-    }
-
-    line = std::move(temp);
-}
-
-
-bool StringIOBuffer::CommentChecker(std::vector<char>& line) const {
+// Комментарий начинается с '#' после пробела или в начале строки. Строка с данными
+// до комментария укорачивается, строка из одного комментария пропускается
+bool StringIOBuffer::CommentChecker(std::string_view& line) const {
     bool is_prev_space = true;
-    bool is_comment = false;
     bool is_symbol = false;
 
-    for (int i = 0; i < line.size(); ++i) {
-        if (std::isspace(line[i])) {
+    for (size_t i = 0; i < line.size(); ++i) {
+        auto el = static_cast<unsigned char>(line[i]);
+        if (std::isspace(el)) {
             is_prev_space = true;
-        } else if (line[i] == '#' && is_prev_space) {
-            line[i] = '\0';
-            is_comment = true;
-            break;
+        } else if (el == '#' && is_prev_space) {
+            line = line.substr(0, i);
+            return !is_symbol;
         } else {
             is_symbol = true;
             is_prev_space = false;
         }
     }
-
-    if (is_comment && is_symbol) {
-        DeleteComment(line);
-        return false;
-    } else if (is_comment) {
-        return true;
-    } else {
-        return false;
-    }
+    return false;
 }
 
 
-} // namespase wiseio
\ No newline at end of file
+} // namespase wiseio
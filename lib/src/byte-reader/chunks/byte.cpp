@@ -1,15 +1,19 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <cstdint>
 #include <cstring>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <vector>
 
+#include "wise-io/buffer_pool.hpp"
+#include "wise-io/byte/byte_buffer.hpp"
 #include "wise-io/byte/chunks.hpp"
 #include "wise-io/byte/storage.hpp"
 #include "wise-io/byte/views.hpp"
+#include "wise-io/reader.hpp"
 #include "wise-io/schemas.hpp"
 #include "wise-io/stream.hpp"
 
@@ -18,18 +22,28 @@ using str = std::string;
 
 namespace wiseio {
 
-ByteChunk::ByteChunk(NumSize size, Endianness num_endianess)
+ByteChunk::ByteChunk(NumSize size, Endianness num_endianess, std::pmr::memory_resource* resource)
     : len_num_size_(size)
-    , num_endianess_(num_endianess) {}
+    , num_endianess_(num_endianess)
+    , data_(resource) {}
 
 
 void ByteChunk::Init(wiseio::Stream& stream) {
+    BufferedReader reader(stream, 0);
+    Init(reader);
+    stream.SetCursor(reader.GetPosition());
+}
+
+
+void ByteChunk::Init(BufferedReader& reader) {
     std::vector<uint8_t> num(static_cast<int>(len_num_size_));
-    stream.CRead(num);
-    offset_ = stream.GetCursor();
+    if (!reader.ReadExact(num)) {
+        throw std::out_of_range("Файл обрезан: не хватает байт на длину чанка");
+    }
+    offset_ = reader.GetPosition();
     NumView view(num, num_endianess_);
     SetSizeNum(view);
-    stream.SetCursor(offset_ + size_);
+    reader.Skip(size_);
     state_ = ChunkInitState::kFileBacked;
 }
 
@@ -38,17 +52,16 @@ void ByteChunk::Load(Stream& stream) {
     if (!IsInitialized()) {
         throw std::runtime_error("Для загрузки чанк должен быть инициализирован");
     }
-    std::vector<uint8_t>& data = data_.GetData();
-    data.resize(size_);
-    stream.CustomRead(data, offset_);
+    data_.Load(stream, offset_, size_);
 }
 
 
 std::vector<uint8_t> ByteChunk::GetCompiledChunk() {
-    std::vector<uint8_t> compiled(static_cast<int>(len_num_size_) + data_.GetData().size());
-    std::vector<uint8_t> num = GetSizeVector();
+    ByteBuffer& data = data_.GetData();
+    std::vector<uint8_t> compiled = BufferPool::Acquire(static_cast<int>(len_num_size_) + data.size());
+    compiled.resize(static_cast<int>(len_num_size_) + data.size());
+    std::vector<uint8_t> num = GetSizeVector(data.size());
     std::memcpy(compiled.data(), num.data(), num.size());
-    std::vector<uint8_t>& data = data_.GetData();
     std::memcpy(compiled.data() + num.size(), data.data(), data.size());  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     return compiled;
 }
@@ -69,12 +82,25 @@ uint64_t ByteChunk::GetSize() {
 }
 
 
+uint64_t ByteChunk::GetCompiledOffset() {
+    return offset_ - static_cast<int>(len_num_size_);
+}
+
+
+uint64_t ByteChunk::GetCompiledSize() {
+    if (data_.IsChanged()) {
+        return static_cast<int>(len_num_size_) + data_.GetSize();
+    }
+    return static_cast<int>(len_num_size_) + size_;
+}
+
+
 Storage& ByteChunk::GetStorage() {
     return data_;
 }
 
 
-void ByteChunk::SetSizeNum(NumView num) {
+void ByteChunk::SetSizeNum(NumView<std::vector<uint8_t>> num) {
     switch (len_num_size_) {
         case (NumSize::kUint8_t) : {
             size_ = num.GetNum<uint8_t>();
@@ -96,24 +122,24 @@ void ByteChunk::SetSizeNum(NumView num) {
 }
 
 
-std::vector<uint8_t> ByteChunk::GetSizeVector() {
+std::vector<uint8_t> ByteChunk::GetSizeVector(uint64_t size) {
     std::vector<uint8_t> num;
     NumView view(num, num_endianess_);
     switch (len_num_size_) {
         case (NumSize::kUint8_t) : {
-            view.SetNum<uint8_t>(size_);
+            view.SetNum<uint8_t>(size);
             break;
         }
         case (NumSize::kUint16_t) : {
-            view.SetNum<uint16_t>(size_);
+            view.SetNum<uint16_t>(size);
             break;
         }
         case (NumSize::kUint32_t) : {
-            view.SetNum<uint32_t>(size_);
+            view.SetNum<uint32_t>(size);
             break;
         }
         case (NumSize::kUint64_t) : {
-            view.SetNum<uint64_t>(size_);
+            view.SetNum<uint64_t>(size);
             break;
         }
     }
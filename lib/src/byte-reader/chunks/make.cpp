@@ -1,7 +1,10 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <sys/types.h>
+#include <utility>
+#include <vector>
 
 #include "wise-io/byte/chunks.hpp"
 #include "wise-io/schemas.hpp"
@@ -11,6 +14,35 @@ using str = std::string;
 
 namespace wiseio {
 
+namespace {
+
+template <class Chunk, class... Args>
+ChunkPtr MakeChunk(std::pmr::memory_resource* resource, Args&&... args) {
+    std::pmr::polymorphic_allocator<> allocator(resource);
+    Chunk* chunk = allocator.new_object<Chunk>(std::forward<Args>(args)..., resource);
+    return {chunk, ChunkDeleter(resource, sizeof(Chunk), alignof(Chunk))};
+}
+
+} // namespace
+
+
+ChunkDeleter::ChunkDeleter(std::pmr::memory_resource* resource, size_t size, size_t alignment)
+        : resource(resource)
+        , size(size)
+        , alignment(alignment) {}
+
+
+void ChunkDeleter::operator()(BaseChunk* chunk) const {
+    if (resource == nullptr) {
+        delete chunk;  // NOLINT(cppcoreguidelines-owning-memory)
+        return;
+    }
+    void* memory = dynamic_cast<void*>(chunk);
+    chunk->~BaseChunk();
+    resource->deallocate(memory, size, alignment);
+}
+
+
 std::unique_ptr<BaseChunk> MakeByteChunk(NumSize len_num_size, Endianness num_endianess) {
     std::unique_ptr<BaseChunk> chunk = std::make_unique<ByteChunk>(
         len_num_size, num_endianess);
@@ -30,4 +62,19 @@ std::unique_ptr<BaseChunk> MakeValidateChunk(uint64_t size, std::vector<uint8_t>
 }
 
 
+ChunkPtr MakeByteChunk(std::pmr::memory_resource* resource, NumSize len_num_size, Endianness num_endianess) {
+    return MakeChunk<ByteChunk>(resource, len_num_size, num_endianess);
+}
+
+
+ChunkPtr MakeNumChunk(std::pmr::memory_resource* resource, NumSize size) {
+    return MakeChunk<NumChunk>(resource, size);
+}
+
+
+ChunkPtr MakeValidateChunk(std::pmr::memory_resource* resource, uint64_t size, std::vector<uint8_t>&& target_value) {
+    return MakeChunk<ValidateChunk>(resource, size, std::move(target_value));
+}
+
+
 } // namespace wiseio
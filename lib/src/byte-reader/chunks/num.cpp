@@ -1,10 +1,16 @@
-#include <cstddef>  // Copyright 2025 wiserin
+#include <array>  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <sys/types.h>
 #include <vector>
 
+#include "wise-io/byte/byte_buffer.hpp"
 #include "wise-io/byte/chunks.hpp"
 #include "wise-io/byte/storage.hpp"
+#include "wise-io/reader.hpp"
 #include "wise-io/schemas.hpp"
 #include "wise-io/stream.hpp"
 
@@ -14,13 +20,21 @@ using str = std::string;
 namespace wiseio {
 
 
-NumChunk::NumChunk(NumSize size)
-        : size_(size) {}
+NumChunk::NumChunk(NumSize size, std::pmr::memory_resource* resource)
+        : data_(resource)
+        , size_(size) {}
 
 
 void NumChunk::Init(Stream& stream) {
-    offset_ = stream.GetCursor();
-    stream.SetCursor(offset_ + static_cast<int>(size_));
+    BufferedReader reader(stream, 0);
+    Init(reader);
+    stream.SetCursor(reader.GetPosition());
+}
+
+
+void NumChunk::Init(BufferedReader& reader) {
+    offset_ = reader.GetPosition();
+    reader.Skip(static_cast<int>(size_));
     state_ = ChunkInitState::kFileBacked;
 }
 
@@ -29,14 +43,18 @@ void NumChunk::Load(Stream& stream) {
     if (!IsInitialized()) {
         throw std::runtime_error("Для загрузки чанк должен быть инициализирован");
     }
-    std::vector<uint8_t>& data = data_.GetData();
-    data.resize(static_cast<int>(size_));
-    stream.CustomRead(data, offset_);
+    // Число читается в стековый буфер, вектор хранилища заполняется один раз без предварительного обнуления
+    std::array<uint8_t, sizeof(uint64_t)> num;  // NOLINT(cppcoreguidelines-pro-type-member-init)
+    ssize_t len = stream.PRead(std::span<uint8_t>(num).first(static_cast<int>(size_)), offset_);
+
+    ByteBuffer& data = data_.GetData();
+    data.assign(num.begin(), num.begin() + (len > 0 ? len : 0));
 }
 
 
 std::vector<uint8_t> NumChunk::GetCompiledChunk() {
-    return data_.GetData();
+    ByteBuffer& data = data_.GetData();
+    return {data.begin(), data.end()};
 } 
 
 
@@ -55,6 +73,19 @@ uint64_t NumChunk::GetSize() {
 }
 
 
+uint64_t NumChunk::GetCompiledOffset() {
+    return offset_;
+}
+
+
+uint64_t NumChunk::GetCompiledSize() {
+    if (data_.IsChanged()) {
+        return data_.GetSize();
+    }
+    return static_cast<size_t>(size_);
+}
+
+
 Storage& NumChunk::GetStorage() {
     return data_;
 }
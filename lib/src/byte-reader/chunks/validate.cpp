@@ -1,10 +1,15 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <cstdint>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "wise-io/buffer_pool.hpp"
+#include "wise-io/byte/byte_buffer.hpp"
 #include "wise-io/byte/chunks.hpp"
+#include "wise-io/reader.hpp"
 #include "wise-io/schemas.hpp"
 #include "wise-io/stream.hpp"
 
@@ -15,16 +20,28 @@ namespace wiseio {
 
 ValidateChunk::ValidateChunk(
         size_t size,
-        std::vector<uint8_t>&& target_value)
+        std::vector<uint8_t>&& target_value,
+        std::pmr::memory_resource* resource)
     : size_(size)
-    , target_value_(std::move(target_value)) {}
+    , target_value_(std::move(target_value))
+    , data_(resource) {}
 
 
 void ValidateChunk::Init(wiseio::Stream& stream) {
-    std::vector<uint8_t> chunk(size_);
-    offset_ = stream.GetCursor();
-    stream.CRead(chunk);
-    if (!Validate(chunk)) {
+    BufferedReader reader(stream, 0);
+    Init(reader);
+    stream.SetCursor(reader.GetPosition());
+}
+
+
+void ValidateChunk::Init(BufferedReader& reader) {
+    std::vector<uint8_t> chunk = BufferPool::Acquire(size_);
+    chunk.resize(size_);
+    offset_ = reader.GetPosition();
+    chunk.resize(reader.Read(chunk));
+    bool is_valid = Validate(chunk);
+    BufferPool::Release(std::move(chunk));
+    if (!is_valid) {
         throw std::logic_error("Данные не совпадают");
     }
     state_ = ChunkInitState::kFileBacked;
@@ -35,14 +52,13 @@ void ValidateChunk::Load(Stream& stream) {
     if (!IsInitialized()) {
         throw std::runtime_error("Для загрузки чанк должен быть инициализирован");
     }
-    std::vector<uint8_t>& data = data_.GetData();
-    data.resize(static_cast<int>(size_));
-    stream.CustomRead(data, offset_);
+    data_.Load(stream, offset_, size_);
 }
 
 
 std::vector<uint8_t> ValidateChunk::GetCompiledChunk() {
-    return data_.GetData();
+    ByteBuffer& data = data_.GetData();
+    return {data.begin(), data.end()};
 }
 
 
@@ -61,6 +77,19 @@ uint64_t ValidateChunk::GetSize() {
 }
 
 
+uint64_t ValidateChunk::GetCompiledOffset() {
+    return offset_;
+}
+
+
+uint64_t ValidateChunk::GetCompiledSize() {
+    if (data_.IsChanged()) {
+        return data_.GetSize();
+    }
+    return size_;
+}
+
+
 Storage& ValidateChunk::GetStorage() {
     return data_;
 }
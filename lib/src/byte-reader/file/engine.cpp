@@ -1,13 +1,18 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <cstdint>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <sys/types.h>
 #include <vector>
 
+#include "wise-io/buffer_pool.hpp"
 #include "wise-io/byte/chunks.hpp"
 #include "wise-io/byte/bytefile.hpp"
 #include "wise-io/byte/storage.hpp"
+#include "wise-io/reader.hpp"
 #include "wise-io/schemas.hpp"
 #include "wise-io/stream.hpp"
 #include "wise-io/utils.hpp"
@@ -24,10 +29,13 @@ ByteFileEngine::ByteFileEngine(const char* file_name)
             file_name, OpenMode::kReadAndWrite)) {}
 
 
-void ByteFileEngine::InitChunks(const std::vector<std::unique_ptr<BaseChunk>>& chunks) {
-    for (const std::unique_ptr<BaseChunk>& chunk : chunks) {
-        chunk->Init(istream_);
+void ByteFileEngine::InitChunks(std::span<const ChunkPtr> chunks) {
+    // Заголовки мелких чанков читаются из общего окна, а не отдельным pread на каждый
+    BufferedReader reader(istream_);
+    for (const ChunkPtr& chunk : chunks) {
+        chunk->Init(reader);
     }
+    istream_.SetCursor(reader.GetPosition());
 }
 
 
@@ -36,22 +44,159 @@ void ByteFileEngine::ReadChunk(BaseChunk& chunk) {
 }
 
 
-void ByteFileEngine::CompileFile(const std::vector<std::unique_ptr<BaseChunk>>& chunks) {
-    Stream ostream = CreateStream(file_name_.parent_path() / FileNamer::GetName(), OpenMode::kAppend);
+void ByteFileEngine::CompileFile(
+        std::span<const ChunkPtr> chunks, CompileMode mode, bool is_sync) {
+    if (mode == CompileMode::kAuto && CanCompileInPlace(chunks)) {
+        CompileInPlace(chunks, is_sync);
+    } else {
+        RewriteFile(chunks, is_sync);
+    }
+}
+
+
+// Патч на месте возможен, только если раскладка файла не меняется: все чанки прочитаны из файла,
+// идут подряд до его конца и каждый измененный чанк сохранил свой размер
+bool ByteFileEngine::CanCompileInPlace(std::span<const ChunkPtr> chunks) {
+    if (!istream_.IsOpen()) {
+        return false;
+    }
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (!chunks[i]->IsInitialized()) {
+            return false;
+        }
+        uint64_t end = i + 1 < chunks.size() ? chunks[i + 1]->GetCompiledOffset() : istream_.GetFileSize();
+        uint64_t offset = chunks[i]->GetCompiledOffset();
+        if (end < offset) {
+            return false;
+        }
+        if (chunks[i]->GetStorage().IsChanged() && chunks[i]->GetCompiledSize() != end - offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+void ByteFileEngine::CompileInPlace(std::span<const ChunkPtr> chunks, bool is_sync) {
+    std::vector<std::vector<uint8_t>> compiled;
+    std::vector<WriteSegment> segments;
+    size_t compiled_size = 0;
+
+    for (const ChunkPtr& chunk : chunks) {
+        if (!chunk->GetStorage().IsChanged()) {
+            continue;
+        }
+        compiled.push_back(chunk->GetCompiledChunk());
+        segments.push_back({compiled.back(), chunk->GetCompiledOffset()});
+        compiled_size += compiled.back().size();
+
+        if (compiled_size >= kCompileFlushSize) {
+            FlushCompiled(istream_, compiled, segments);
+            compiled_size = 0;
+        }
+    }
+    FlushCompiled(istream_, compiled, segments);
+
+    if (is_sync) {
+        istream_.Sync();
+    }
+}
+
+
+void ByteFileEngine::RewriteFile(std::span<const ChunkPtr> chunks, bool is_sync) {
+    Stream ostream = CreateTempStream(file_name_.parent_path());
+    if (is_sync) {
+        ostream.SetDurability(Durability::kFull);
+    }
+
+    uint64_t total_size = 0;
+    for (const ChunkPtr& chunk : chunks) {
+        if (chunk->GetStorage().IsChanged() || chunk->IsInitialized()) {
+            total_size += chunk->GetCompiledSize();
+        }
+    }
+    ostream.Reserve(total_size);
+
+    std::vector<std::vector<uint8_t>> compiled;
+    std::vector<WriteSegment> segments;
+    size_t compiled_size = 0;
+    CopyRun run;
+    uint64_t out_offset = 0;
 
-    for (const std::unique_ptr<BaseChunk>& chunk : chunks) {
+    istream_.Advise(AccessAdvice::kSequential);
+
+    for (const ChunkPtr& chunk : chunks) {
         if (chunk->GetStorage().IsChanged()) {
-            std::vector<uint8_t> data = chunk->GetCompiledChunk();
-            ostream.AWrite(data);
+            compiled.push_back(chunk->GetCompiledChunk());
+            segments.push_back({compiled.back(), out_offset});
+            compiled_size += compiled.back().size();
+            out_offset += compiled.back().size();
         } else if (chunk->IsInitialized()) {
-            ReadChunk(*chunk); // TODO оптимизировать количество копирований
-            std::vector<uint8_t> data = chunk->GetCompiledChunk();
-            ostream.AWrite(data);
+            // Нетронутый чанк копируется из старого файла внутри ядра, соседние диапазоны склеиваются
+            uint64_t offset = chunk->GetCompiledOffset();
+            uint64_t size = chunk->GetCompiledSize();
+            if (run.size > 0 && run.offset + run.size == offset && run.out_offset + run.size == out_offset) {
+                run.size += size;
+            } else {
+                FlushCopy(ostream, run);
+                run = {offset, size, out_offset};
+            }
+            out_offset += size;
+        }
+
+        if (compiled_size >= kCompileFlushSize) {
+            FlushCompiled(ostream, compiled, segments);
+            compiled_size = 0;
         }
     }
-    istream_.SetDelete();
+    FlushCopy(ostream, run);
+    FlushCompiled(ostream, compiled, segments);
+
+    istream_.Advise(AccessAdvice::kDontNeed);
     istream_.Close();
-    ostream.Rename(file_name_.filename());
+    LinkCompiled(ostream);
+    ostream.Rename(file_name_.filename());  // rename атомарно заменяет старый файл
+}
+
+
+// linkat не перезаписывает существующий файл, поэтому новый файл получает временное имя и затем заменяет старый
+void ByteFileEngine::LinkCompiled(Stream& ostream) {
+    if (!ostream.IsAnonymous()) {
+        return;
+    }
+    for (size_t attempt = 0; attempt < kLinkAttempts; ++attempt) {
+        if (ostream.Link(file_name_.parent_path() / FileNamer::GetName())) {
+            return;
+        }
+    }
+    throw std::runtime_error("Не удалось создать имя для скомпилированного файла");
+}
+
+
+void ByteFileEngine::FlushCompiled(
+        Stream& ostream, std::vector<std::vector<uint8_t>>& compiled, std::vector<WriteSegment>& segments) {
+    if (segments.empty()) {
+        return;
+    }
+    if (!ostream.CustomWrite(segments)) {
+        throw std::runtime_error("Не удалось записать скомпилированные чанки");
+    }
+    segments.clear();
+    for (std::vector<uint8_t>& buffer : compiled) {
+        BufferPool::Release(std::move(buffer));
+    }
+    compiled.clear();
+}
+
+
+void ByteFileEngine::FlushCopy(Stream& ostream, CopyRun& run) {
+    if (run.size == 0) {
+        return;
+    }
+    if (!istream_.CopyRange(ostream, run.offset, run.size, run.out_offset)) {
+        throw std::runtime_error("Не удалось скопировать чанки из исходного файла");
+    }
+    run.size = 0;
 }
 
 
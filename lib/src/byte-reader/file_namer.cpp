@@ -1,4 +1,5 @@
 #include <string>  // Copyright 2025 wiserin
+#include <unistd.h>
 
 #include <wise-io/utils.hpp>
 
@@ -8,9 +9,8 @@ using str = std::string;
 namespace wiseio {
 
 str FileNamer::GetName() {
-    str name = "__" + std::to_string(current) + ".bin";
-    ++current;
-    return name;
+    // pid в имени разводит процессы, работающие в одном каталоге
+    return "__" + std::to_string(getpid()) + "_" + std::to_string(current++) + ".bin";
 }
 
 } // namespace wiseio
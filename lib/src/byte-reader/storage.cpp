@@ -1,11 +1,14 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <cstdint>
 #include <filesystem>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <sys/types.h>
-#include <vector>
+#include <utility>
 
+#include "wise-io/byte/byte_buffer.hpp"
 #include "wise-io/byte/storage.hpp"
 #include "wise-io/schemas.hpp"
 #include "wise-io/utils.hpp"
@@ -15,7 +18,11 @@ using str = std::string;
 
 namespace wiseio {
 
-std::vector<uint8_t>& Storage::GetData() {
+Storage::Storage(std::pmr::memory_resource* resource)
+        : data_(resource) {}
+
+
+ByteBuffer& Storage::GetData() {
     if (state_ == StorageState::kCommited) {
         ReadFromCache();
     }
@@ -24,8 +31,25 @@ std::vector<uint8_t>& Storage::GetData() {
 }
 
 
+void Storage::Load(Stream& stream, uint64_t offset, size_t size) {
+    (void)GetData();
+    ReadRange(stream, offset, size);
+}
+
+
 void Storage::ReadFromCache() {
-    stream_.ReadAll(data_);
+    ReadRange(stream_, 0, stream_.GetFileSize());
+    stream_.Advise(AccessAdvice::kDontNeed);  // кэш читается один раз, страницы больше не нужны
+}
+
+
+// clear перед resize: при переезде в больший буфер старые байты не копируются.
+// resize не обнуляет новые байты (DefaultInitAllocator), PRead пишет прямо в вектор
+void Storage::ReadRange(Stream& stream, uint64_t offset, size_t size) {
+    data_.clear();
+    data_.resize(size);
+    ssize_t len = stream.PRead(std::span<uint8_t>(data_), offset);
+    data_.resize(len > 0 ? static_cast<size_t>(len) : 0);
 }
 
 
@@ -34,6 +58,14 @@ bool Storage::IsChanged() {
 }
 
 
+size_t Storage::GetSize() {
+    if (state_ == StorageState::kCommited) {
+        return stream_.GetFileSize();
+    }
+    return data_.size();
+}
+
+
 void Storage::SetCacheDir(str&& path) {
     if (!std::filesystem::is_directory(path)) {
         throw std::runtime_error("Неизвестная дирректория");
@@ -46,11 +78,15 @@ void Storage::Commit() {
     if (stream_.IsOpen()) {
         stream_.Close();
     }
-    stream_ = CreateStream(cache_dir / FileNamer::GetName(), OpenMode::kReadAndWrite, true);
+    stream_ = CreateTempStream(cache_dir);
+    stream_.SetDelete();
 
+    if (data_.size() >= kReserveThreshold) {
+        stream_.Reserve(data_.size());
+    }
     stream_.CWrite(data_);
 
-    std::vector<uint8_t>().swap(data_);
+    data_ = ByteBuffer(data_.get_allocator());  // освобождает память, а не только обнуляет размер
 
     state_ = StorageState::kCommited;
 }
@@ -0,0 +1,195 @@
+#include <coroutine>  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <core.h>
+
+#include "wise-io/async.hpp"
+#include "wise-io/byte/byte_buffer.hpp"
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+using str = std::string;
+
+namespace wiseio {
+
+namespace {
+
+template<typename Buffer>
+void Truncate(void* target, size_t size) {
+    static_cast<Buffer*>(target)->resize(size);
+}
+
+} // namespace
+
+
+AsyncIO::AsyncIO(const Stream* stream, Reactor* reactor)
+        : stream_(stream)
+        , reactor_(reactor) {}
+
+
+bool AsyncIO::await_ready() const noexcept {
+    return ready_.has_value();
+}
+
+
+void AsyncIO::await_suspend(std::coroutine_handle<> handle) {
+    op_.continuation = handle;
+    Reactor& reactor = reactor_ != nullptr ? *reactor_ : Reactor::GetDefault();
+    reactor.Submit(&op_);
+}
+
+
+// Выполняется в потоке реактора. Ошибки, как в Try*, возвращаются только в результате:
+// последняя ошибка стрима не синхронизирована. Размер файла и окно write-behind атомарны
+IOResult AsyncIO::await_resume() {
+    if (ready_.has_value()) {
+        return *ready_;
+    }
+    if (op_.error != 0) {
+        return std::unexpected(std::error_code(op_.error, std::generic_category()));
+    }
+
+    if (op_.kind == AsyncOp::Kind::kWrite) {
+        if (is_append_) {
+            writer_->TrackAppend(op_.size);
+        } else {
+            writer_->TrackWrite(op_.offset, op_.size);
+        }
+    }
+    if (read_target_ != nullptr) {
+        truncate_target_(read_target_, op_.done);
+    }
+    return op_.done;
+}
+
+
+AsyncIO Stream::AsyncRead(std::span<uint8_t> buffer, size_t offset, Reactor* reactor) const {
+    AsyncIO io(this, reactor);
+    if (!IsOpen()) {
+        io.ready_ = std::unexpected(make_error_code(StreamError::kClosed));
+        return io;
+    }
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
+        io.ready_ = std::unexpected(make_error_code(StreamError::kWrongMode));
+        return io;
+    }
+    if (buffer.empty()) {
+        io.ready_ = 0;
+        return io;
+    }
+    // Отображение уже в памяти, реактору отдавать нечего
+    if (backend_ == IOBackend::kMmap) {
+        bool is_eof = false;
+        io.ready_ = static_cast<size_t>(wcore_mapped_custom_read(
+            backend_state_->map_data, backend_state_->map_size, buffer.data(), offset, buffer.size(), &is_eof));
+        return io;
+    }
+
+    io.op_.kind = AsyncOp::Kind::kRead;
+    io.op_.fd = fd_;
+    io.op_.is_direct = backend_ == IOBackend::kDirect;
+    io.op_.buffer = buffer.data();
+    io.op_.size = buffer.size();
+    io.op_.offset = offset;
+    return io;
+}
+
+
+AsyncIO Stream::AsyncReadAll(std::vector<uint8_t>& buffer, Reactor* reactor) const {
+    if (IsOpen() && (mode_ == OpenMode::kRead || mode_ == OpenMode::kReadAndWrite)) {
+        buffer.resize(file_size_);
+    }
+    AsyncIO io = AsyncRead(buffer, 0, reactor);
+    io.read_target_ = &buffer;
+    io.truncate_target_ = Truncate<std::vector<uint8_t>>;
+    return io;
+}
+
+
+AsyncIO Stream::AsyncReadAll(ByteBuffer& buffer, Reactor* reactor) const {
+    if (IsOpen() && (mode_ == OpenMode::kRead || mode_ == OpenMode::kReadAndWrite)) {
+        buffer.clear();  // при переезде в больший буфер старые байты не копируются
+        buffer.resize(file_size_);
+    }
+    AsyncIO io = AsyncRead(buffer, 0, reactor);
+    io.read_target_ = &buffer;
+    io.truncate_target_ = Truncate<ByteBuffer>;
+    return io;
+}
+
+
+AsyncIO Stream::AsyncReadAll(str& buffer, Reactor* reactor) const {
+    if (IsOpen() && (mode_ == OpenMode::kRead || mode_ == OpenMode::kReadAndWrite)) {
+        buffer.resize_and_overwrite(file_size_, [](char* /*data*/, size_t size) { return size; });
+    }
+    AsyncIO io = AsyncRead(std::span<uint8_t>(
+        reinterpret_cast<uint8_t*>(buffer.data()), buffer.size()), 0, reactor);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    io.read_target_ = &buffer;
+    io.truncate_target_ = Truncate<str>;
+    return io;
+}
+
+
+AsyncIO Stream::AsyncWrite(std::span<const uint8_t> buffer, size_t offset, Reactor* reactor) {
+    AsyncIO io(this, reactor);
+    if (!IsOpen()) {
+        io.ready_ = std::unexpected(make_error_code(StreamError::kClosed));
+        return io;
+    }
+    if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
+        io.ready_ = std::unexpected(make_error_code(StreamError::kWrongMode));
+        return io;
+    }
+    if (buffer.empty()) {
+        io.ready_ = 0;
+        return io;
+    }
+
+    io.op_.kind = AsyncOp::Kind::kWrite;
+    io.op_.fd = fd_;
+    io.op_.is_direct = backend_ == IOBackend::kDirect;
+    io.op_.buffer = const_cast<uint8_t*>(buffer.data());  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    io.op_.size = buffer.size();
+    io.op_.offset = offset;
+    io.writer_ = this;
+    return io;
+}
+
+
+// Файл открыт с O_APPEND: ядро дописывает в конец независимо от смещения в запросе
+AsyncIO Stream::AsyncAWrite(std::span<const uint8_t> buffer, Reactor* reactor) {
+    AsyncIO io(this, reactor);
+    if (!IsOpen()) {
+        io.ready_ = std::unexpected(make_error_code(StreamError::kClosed));
+        return io;
+    }
+    if (mode_ != OpenMode::kAppend) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Append");
+        io.ready_ = std::unexpected(make_error_code(StreamError::kWrongMode));
+        return io;
+    }
+    if (buffer.empty()) {
+        io.ready_ = 0;
+        return io;
+    }
+
+    io.op_.kind = AsyncOp::Kind::kWrite;
+    io.op_.fd = fd_;
+    io.op_.buffer = const_cast<uint8_t*>(buffer.data());  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    io.op_.size = buffer.size();
+    io.op_.offset = file_size_;
+    io.is_append_ = true;
+    io.writer_ = this;
+    return io;
+}
+
+} // namespace wiseio
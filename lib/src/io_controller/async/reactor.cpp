@@ -0,0 +1,113 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <core.h>
+
+#include "wise-io/async.hpp"
+#include "wise-io/schemas.hpp"
+
+
+namespace wiseio {
+
+void Reactor::Execute(AsyncOp* op) {
+    if (op->kind == AsyncOp::Kind::kRead) {
+        bool is_eof = false;
+        ssize_t len = op->is_direct
+            ? wcore_direct_custom_read(op->fd, op->buffer, op->offset, op->size, &is_eof)
+            : wcore_custom_read(op->fd, op->buffer, op->offset, op->size, &is_eof);
+        if (len < 0) {
+            op->error = errno;
+            return;
+        }
+        op->done = static_cast<size_t>(len);
+        return;
+    }
+
+    bool state = op->is_direct
+        ? wcore_direct_custom_write(op->fd, op->buffer, op->offset, op->size)
+        : wcore_custom_write(op->fd, op->buffer, op->offset, op->size);
+    if (!state) {
+        op->error = errno;
+        return;
+    }
+    op->done = op->size;
+}
+
+
+void Reactor::SetDefault(Reactor* reactor) {
+    default_reactor.store(reactor, std::memory_order_release);
+}
+
+
+Reactor& Reactor::GetDefault() {
+    Reactor* reactor = default_reactor.load(std::memory_order_acquire);
+    if (reactor != nullptr) {
+        return *reactor;
+    }
+    static const std::unique_ptr<Reactor> shared = CreateReactor();
+    return *shared;
+}
+
+
+ThreadPoolReactor::ThreadPoolReactor(size_t threads) {
+    workers_.reserve(threads);
+    for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+        workers_.emplace_back(&ThreadPoolReactor::Worker, this);
+    }
+}
+
+
+void ThreadPoolReactor::Worker() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return !queue_.empty() || is_stopped_; });
+        if (queue_.empty()) {
+            return;
+        }
+        AsyncOp* op = queue_.front();
+        queue_.pop_front();
+
+        lock.unlock();
+        Execute(op);
+        op->continuation.resume();
+        lock.lock();
+    }
+}
+
+
+void ThreadPoolReactor::Submit(AsyncOp* op) {
+    {
+        std::lock_guard lock(mutex_);
+        queue_.push_back(op);
+    }
+    cv_.notify_one();
+}
+
+
+ThreadPoolReactor::~ThreadPoolReactor() {
+    {
+        std::lock_guard lock(mutex_);
+        is_stopped_ = true;
+    }
+    cv_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+
+std::unique_ptr<Reactor> CreateReactor(IOBackend backend, size_t threads) {
+    if (backend == IOBackend::kIOUring) {
+        std::unique_ptr<UringReactor> reactor = UringReactor::Create();
+        if (reactor != nullptr) {
+            return reactor;
+        }
+    }
+    return std::make_unique<ThreadPoolReactor>(threads);
+}
+
+} // namespace wiseio
@@ -0,0 +1,203 @@
+#include <array>  // Copyright 2025 wiserin
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <core.h>
+
+#include "wise-io/async.hpp"
+
+
+namespace wiseio {
+
+namespace {
+
+bool IsDirectAligned(const AsyncOp* op) {
+    return reinterpret_cast<uintptr_t>(op->buffer) % WCORE_DIRECT_ALIGNMENT == 0  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        && op->offset % WCORE_DIRECT_ALIGNMENT == 0
+        && op->size % WCORE_DIRECT_ALIGNMENT == 0;
+}
+
+} // namespace
+
+
+UringReactor::UringReactor(wcore_uring* ring)
+        : ring_(ring)
+        , worker_(&UringReactor::Worker, this) {}
+
+
+std::unique_ptr<UringReactor> UringReactor::Create(unsigned entries) {
+    wcore_uring* ring = wcore_uring_create(entries);
+    if (ring == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<UringReactor>(new UringReactor(ring));
+}
+
+
+// Вызывается под mutex_. Дочитывание и повтор после EINTR идут с того же места, что и первая отправка
+bool UringReactor::Prep(AsyncOp* op) {
+    uint64_t user_data = reinterpret_cast<uintptr_t>(op);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    bool state = op->kind == AsyncOp::Kind::kRead
+        ? wcore_uring_prep_read(
+            ring_, op->fd, op->buffer + op->done, op->offset + op->done, op->size - op->done, user_data)  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        : wcore_uring_prep_write(
+            ring_, op->fd, op->buffer + op->done, op->offset + op->done, op->size - op->done, user_data);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (state) {
+        ++prepped_;
+        in_ring_.insert(op);
+    }
+    return state;
+}
+
+
+// Вызывается под mutex_. При ошибке SQE остаются подготовленными и уйдут со следующей отправкой
+void UringReactor::SubmitPrepped() {
+    int res = wcore_uring_submit(ring_, 0);
+    if (res > 0) {
+        prepped_ -= static_cast<size_t>(res);
+        inflight_ += static_cast<size_t>(res);
+    }
+}
+
+
+void UringReactor::Submit(AsyncOp* op) {
+    if (op->is_direct && !IsDirectAligned(op)) {
+        fallback_.Submit(op);
+        return;
+    }
+    {
+        std::unique_lock lock(mutex_);
+        if (is_broken_) {
+            lock.unlock();
+            fallback_.Submit(op);
+            return;
+        }
+        if (queue_.empty() && Prep(op)) {
+            SubmitPrepped();
+        } else {
+            queue_.push_back(op);
+        }
+    }
+    cv_.notify_one();
+}
+
+
+// Вызывается под mutex_. Операции в кольце завершаются с ошибкой ожидания,
+// очередь и все следующие операции уходят в пул потоков
+void UringReactor::Break(int error, std::vector<AsyncOp*>& finished) {
+    is_broken_ = true;
+    for (AsyncOp* op : in_ring_) {
+        op->error = error;
+        finished.push_back(op);
+    }
+    in_ring_.clear();
+    prepped_ = 0;
+    inflight_ = 0;
+
+    for (AsyncOp* op : queue_) {
+        op->done = 0;  // пул потоков выполняет операцию целиком
+        fallback_.Submit(op);
+    }
+    queue_.clear();
+}
+
+
+void UringReactor::Worker() {
+    std::array<wcore_uring_cqe_t, kReapBatch> cqes {};
+    std::vector<AsyncOp*> finished;
+
+    std::unique_lock lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return inflight_ > 0 || prepped_ > 0 || is_stopped_; });
+        if (prepped_ > 0) {
+            SubmitPrepped();
+        }
+        if (inflight_ == 0) {
+            if (prepped_ == 0 && is_stopped_) {
+                return;
+            }
+            // Ядру не хватило ресурсов на отправку, ждать пока нечего
+            lock.unlock();
+            std::this_thread::yield();
+            lock.lock();
+            continue;
+        }
+
+        // EINTR повторяется внутри wcore_uring_wait. EBUSY - переполнена очередь CQE, ее разгребает reap.
+        // На нехватку ресурсов ядра пауза вместо повторного вызова в цикле, остальное неисправимо
+        lock.unlock();
+        int wait_error = wcore_uring_wait(ring_) == 0 ? 0 : errno;
+        if (wait_error == EAGAIN || wait_error == ENOMEM) {
+            std::this_thread::sleep_for(kWaitBackoff);
+        }
+        lock.lock();
+
+        if (wait_error != 0 && wait_error != EBUSY && wait_error != EAGAIN && wait_error != ENOMEM) {
+            Break(wait_error, finished);
+        }
+
+        size_t count = is_broken_ ? 0 : wcore_uring_reap(ring_, cqes.data(), cqes.size());
+        inflight_ -= count;
+        for (size_t i = 0; i < count; ++i) {
+            auto* op = reinterpret_cast<AsyncOp*>(static_cast<uintptr_t>(cqes[i].user_data));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+            int32_t res = cqes[i].result;
+            in_ring_.erase(op);
+
+            if (res == -EINTR || res == -EAGAIN) {
+                if (!Prep(op)) {
+                    queue_.push_back(op);
+                }
+                continue;
+            }
+            if (res < 0) {
+                op->error = -res;
+            } else if (res == 0 && op->kind == AsyncOp::Kind::kWrite) {
+                op->error = ENOSPC;
+            } else if (res > 0) {
+                op->done += static_cast<size_t>(res);
+                // короткое чтение дочитывается, конец файла придет нулевым ответом
+                if (op->done < op->size) {
+                    if (!Prep(op)) {
+                        queue_.push_back(op);
+                    }
+                    continue;
+                }
+            }
+            finished.push_back(op);
+        }
+
+        while (!queue_.empty() && Prep(queue_.front())) {
+            queue_.pop_front();
+        }
+        if (prepped_ > 0) {
+            SubmitPrepped();
+        }
+
+        // После resume корутина может уничтожить AsyncOp, поэтому мьютекс уже отпущен
+        lock.unlock();
+        for (AsyncOp* op : finished) {
+            op->continuation.resume();
+        }
+        finished.clear();
+        lock.lock();
+    }
+}
+
+
+UringReactor::~UringReactor() {
+    {
+        std::lock_guard lock(mutex_);
+        is_stopped_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+    wcore_uring_destroy(ring_);
+}
+
+} // namespace wiseio
@@ -0,0 +1,72 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <vector>
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+ssize_t Stream::CustomRead(std::vector<ReadSegment>& segments) {
+    if (is_eof_) {
+        return 0;
+    }
+    FdCheck();
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
+        return 0;
+    }
+
+    std::vector<wcore_segment_t> core_segments;
+    core_segments.reserve(segments.size());
+    for (const ReadSegment& segment : segments) {
+        core_segments.push_back({segment.buffer.data(), segment.buffer.size(), segment.offset, 0});
+    }
+
+    ssize_t len = 0;
+    switch (backend_) {
+        case (IOBackend::kIOUring) : {
+            len = wcore_uring_custom_read_batch(
+                backend_state_->ring, fd_, core_segments.data(), core_segments.size(), &is_eof_);
+            break;
+        }
+        case (IOBackend::kMmap) : {
+            for (wcore_segment_t& segment : core_segments) {
+                segment.result = wcore_mapped_custom_read(
+                    backend_state_->map_data, backend_state_->map_size, segment.buffer, segment.offset, segment.buffer_size, &is_eof_);
+                len += segment.result;
+            }
+            break;
+        }
+        case (IOBackend::kDirect) : {
+            for (wcore_segment_t& segment : core_segments) {
+                segment.result = wcore_direct_custom_read(
+                    fd_, segment.buffer, segment.offset, segment.buffer_size, &is_eof_);
+                if (segment.result < 0) {
+                    RecordIOError();
+                    return -1;
+                }
+                len += segment.result;
+            }
+            break;
+        }
+        default : {
+            len = wcore_custom_readv(
+                fd_, core_segments.data(), core_segments.size(), &is_eof_);
+        }
+    }
+    if (len < 0) {
+        RecordIOError();
+        return len;
+    }
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+        segments[i].buffer = segments[i].buffer.first(core_segments[i].result);
+    }
+    return len;
+}
+
+} // namespace wiseio
@@ -0,0 +1,161 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <sys/types.h>
+
+#include "wise-io/reader.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+BufferedReader::BufferedReader(Stream& stream, size_t window)
+        : BufferedReader(stream, stream.GetCursor(), window) {}
+
+
+BufferedReader::BufferedReader(Stream& stream, size_t position, size_t window)
+        : stream_(stream)
+        , window_(window)
+        , position_(position) {}
+
+
+size_t BufferedReader::GetAvailable() const {
+    return end_ - begin_;
+}
+
+
+// Чтение ограничивается размером файла, чтобы не запрашивать байты за его концом
+size_t BufferedReader::GetFileEnd() {
+    if (!is_size_known_) {
+        file_size_ = stream_.GetFileSize();
+        is_size_known_ = true;
+    }
+    return file_size_;
+}
+
+
+// Дочитывает буфер так, чтобы в нем было не меньше size байт (или все до конца файла)
+size_t BufferedReader::Fill(size_t size) {
+    if (GetAvailable() >= size) {
+        return GetAvailable();
+    }
+
+    size_t capacity = std::max(window_, size);
+    if (capacity > capacity_) {
+        auto buffer = std::make_unique_for_overwrite<uint8_t[]>(capacity);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        // До первого заполнения buffer_ пуст, memcpy с nullptr - UB даже на 0 байт
+        if (GetAvailable() > 0) {
+            std::memcpy(buffer.get(), buffer_.get() + begin_, GetAvailable());  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        buffer_ = std::move(buffer);
+        capacity_ = capacity;
+    } else if (begin_ > 0) {
+        std::memmove(buffer_.get(), buffer_.get() + begin_, GetAvailable());  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    end_ = GetAvailable();
+    begin_ = 0;
+
+    size_t offset = position_ + end_;
+    size_t file_end = GetFileEnd();
+    if (offset >= file_end) {
+        return GetAvailable();
+    }
+    size_t count = std::min(capacity_ - end_, file_end - offset);
+
+    ssize_t len = stream_.PRead(std::span<uint8_t>(buffer_.get() + end_, count), offset);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (len > 0) {
+        end_ += len;
+    }
+    return GetAvailable();
+}
+
+
+size_t BufferedReader::ReadDirect(std::span<uint8_t> buffer) {
+    if (window_ > 0) {
+        size_t file_end = GetFileEnd();
+        buffer = buffer.first(position_ < file_end ? std::min(buffer.size(), file_end - position_) : 0);
+    }
+    if (buffer.empty()) {
+        return 0;
+    }
+    ssize_t len = stream_.PRead(buffer, position_);
+    if (len <= 0) {
+        return 0;
+    }
+    position_ += len;
+    return len;
+}
+
+
+std::span<const uint8_t> BufferedReader::Peek(size_t size) {
+    size_t available = Fill(size);
+    return {buffer_.get() + begin_, std::min(size, available)};  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+// Пропуск за конец файла не двигает позицию: чанки проверяют через него свои границы
+size_t BufferedReader::Skip(size_t size) {
+    size_t file_end = GetFileEnd();
+    if (position_ > file_end || size > file_end - position_) {
+        throw std::out_of_range(
+            "Пропуск выходит за конец файла. Позиция: " + std::to_string(position_)
+            + " запрошено: " + std::to_string(size) + " размер файла: " + std::to_string(file_end));
+    }
+    size_t buffered = std::min(size, GetAvailable());
+    begin_ += buffered;
+    position_ += size;
+    if (begin_ == end_) {
+        begin_ = 0;
+        end_ = 0;
+    }
+    return size;
+}
+
+
+size_t BufferedReader::Read(std::span<uint8_t> buffer) {
+    size_t buffered = std::min(buffer.size(), GetAvailable());
+    if (buffered > 0) {
+        std::memcpy(buffer.data(), buffer_.get() + begin_, buffered);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        Skip(buffered);
+    }
+
+    std::span<uint8_t> rest = buffer.subspan(buffered);
+    if (rest.empty()) {
+        return buffered;
+    }
+
+    // Запрос больше окна читается напрямую в буфер вызывающего, без промежуточной копии
+    if (window_ == 0 || rest.size() >= window_) {
+        return buffered + ReadDirect(rest);
+    }
+
+    size_t available = Fill(rest.size());
+    size_t count = std::min(rest.size(), available);
+    if (count > 0) {
+        std::memcpy(rest.data(), buffer_.get() + begin_, count);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        Skip(count);
+    }
+    return buffered + count;
+}
+
+
+bool BufferedReader::ReadExact(std::span<uint8_t> buffer) {
+    return Read(buffer) == buffer.size();
+}
+
+
+size_t BufferedReader::GetPosition() const {
+    return position_;
+}
+
+
+Stream& BufferedReader::GetStream() {
+    return stream_;
+}
+
+} // namespace wiseio
@@ -1,4 +1,6 @@
-#include <cstdint>  // Copyright 2025 wiserin
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -18,13 +20,12 @@ ssize_t Stream::CRead(std::vector<uint8_t>& buffer) {
     }
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
 
-    ssize_t len =  wcore_cread(
-        fd_, buffer.data(), buffer.size(),
-        &is_eof_, &cursor_);
+    ssize_t len =  CoreCRead(
+        buffer.data(), buffer.size());
     if (len >= 0) {
         buffer.resize(len);
     }
@@ -38,13 +39,12 @@ ssize_t Stream::CRead(IOBuffer& buffer) {
     }
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
 
-    ssize_t len =  wcore_cread(
-        fd_, buffer.GetDataPtr(), buffer.GetBufferSize(),
-        &is_eof_, &cursor_);
+    ssize_t len =  CoreCRead(
+        buffer.GetDataPtr(), buffer.GetBufferSize());
     if (len >= 0) {
         buffer.ResizeBuffer(len);
     }
@@ -57,18 +57,37 @@ ssize_t Stream::CRead(str& buffer) {
     }
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
 
-    ssize_t len =  wcore_cread(
-        fd_, reinterpret_cast<uint8_t*>(buffer.data()), buffer.size(),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-        &is_eof_, &cursor_);
+    ssize_t len =  CoreCRead(
+        reinterpret_cast<uint8_t*>(buffer.data()), buffer.size());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
     if (len >= 0) {
         buffer.resize(len);
     }
     return len;
 }
 
+
+// Буфер принадлежит вызывающему и не меняет размер: прочитано ровно столько, сколько вернул метод
+ssize_t Stream::CRead(std::span<uint8_t> buffer) {
+    if (is_eof_) {
+        return 0;
+    }
+    FdCheck();
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
+        return 0;
+    }
+    return CoreCRead(buffer.data(), buffer.size());
+}
+
+
+ssize_t Stream::CRead(std::span<std::byte> buffer) {
+    return CRead(std::span<uint8_t>(
+        reinterpret_cast<uint8_t*>(buffer.data()), buffer.size()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
 } // namespace wiseio
 
@@ -1,5 +1,6 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -19,13 +20,12 @@ ssize_t Stream::CustomRead(std::vector<uint8_t>& buffer, size_t offset) {
     }
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
 
-    ssize_t len = wcore_custom_read(
-        fd_, buffer.data(), offset, buffer.size(),
-        &is_eof_);
+    ssize_t len = CoreCustomRead(
+        buffer.data(), offset, buffer.size());
     if (len >= 0) {
         buffer.resize(len);
     }
@@ -39,13 +39,12 @@ ssize_t Stream::CustomRead(IOBuffer& buffer, size_t offset) {
     }
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
 
-    ssize_t len = wcore_custom_read(
-        fd_, buffer.GetDataPtr(), offset, buffer.GetBufferSize(),
-        &is_eof_);
+    ssize_t len = CoreCustomRead(
+        buffer.GetDataPtr(), offset, buffer.GetBufferSize());
     if (len >= 0) {
         buffer.ResizeBuffer(len);
     }
@@ -58,13 +57,12 @@ ssize_t Stream::CustomRead(str& buffer, size_t offset) {
     }
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
 
-    ssize_t len = wcore_custom_read(
-        fd_, reinterpret_cast<uint8_t*>(buffer.data()), offset, buffer.size(),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-        &is_eof_);
+    ssize_t len = CoreCustomRead(
+        reinterpret_cast<uint8_t*>(buffer.data()), offset, buffer.size());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
     if (len >= 0) {
         buffer.resize(len);
     }
@@ -72,5 +70,24 @@ ssize_t Stream::CustomRead(str& buffer, size_t offset) {
     return len;
 }
 
+
+ssize_t Stream::CustomRead(std::span<uint8_t> buffer, size_t offset) {
+    if (is_eof_) {
+        return 0;
+    }
+    FdCheck();
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
+        return 0;
+    }
+    return CoreCustomRead(buffer.data(), offset, buffer.size());
+}
+
+
+ssize_t Stream::CustomRead(std::span<std::byte> buffer, size_t offset) {
+    return CustomRead(std::span<uint8_t>(
+        reinterpret_cast<uint8_t*>(buffer.data()), buffer.size()), offset);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
 } // namespace wiseio
 
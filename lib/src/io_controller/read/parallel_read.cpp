@@ -0,0 +1,143 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <core.h>
+
+#include "wise-io/buffer.hpp"
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+namespace {
+
+// Потоки параллельного чтения общие для всех стримов: создаются по мере надобности
+// и живут до выхода из программы, а не запускаются заново на каждый ReadAll
+class ReadWorkers {
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    bool is_stopped_ = false;
+
+    void Worker() {
+        std::unique_lock lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this]() { return !tasks_.empty() || is_stopped_; });
+            if (tasks_.empty()) {
+                return;
+            }
+            std::function<void()> task = std::move(tasks_.front());
+            tasks_.pop_front();
+
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+ public:
+    // count копий задачи. Потоков не меньше count, лишние задачи ждут свободного потока
+    void Run(size_t count, const std::function<void()>& task) {
+        {
+            std::lock_guard lock(mutex_);
+            while (threads_.size() < count) {
+                threads_.emplace_back(&ReadWorkers::Worker, this);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                tasks_.push_back(task);
+            }
+        }
+        cv_.notify_all();
+    }
+
+    ~ReadWorkers() {
+        {
+            std::lock_guard lock(mutex_);
+            is_stopped_ = true;
+        }
+        cv_.notify_all();
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+};
+
+
+ReadWorkers& GetReadWorkers() {
+    static ReadWorkers workers;
+    return workers;
+}
+
+} // namespace
+
+
+// Диапазоны раздаются потокам по одному через счетчик, поэтому медленный диапазон
+// не задерживает остальные. Вызывающий поток читает наравне с общими потоками и ждет их,
+// даже если все диапазоны уже прочитаны: задачи ссылаются на его стек
+ssize_t Stream::CoreReadAllParallel(uint8_t* buffer, size_t f_size, const ParallelReadOptions& options) {
+    size_t split = AlignedIOBuffer::RoundUp(
+        std::max<size_t>(options.split_size, 1), WCORE_DIRECT_ALIGNMENT);
+    size_t parts = (f_size + split - 1) / split;
+    size_t workers = std::min(options.workers, parts);
+    if (workers <= 1) {
+        return CoreReadAll(buffer, f_size);
+    }
+
+    std::atomic<size_t> next = 0;
+    std::atomic<size_t> read_until = f_size;  // начало первой дыры, если файл укоротили во время чтения
+    std::atomic<int> error = 0;
+
+    auto worker = [&]() {
+        for (size_t part = next++; part < parts && error == 0; part = next++) {
+            size_t begin = part * split;
+            size_t size = std::min(split, f_size - begin);
+            ssize_t len = CorePRead({buffer + begin, size}, begin);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (len < 0) {
+                int expected = 0;
+                error.compare_exchange_strong(expected, errno);
+                return;
+            }
+            if (static_cast<size_t>(len) < size) {
+                size_t end = begin + static_cast<size_t>(len);
+                size_t current = read_until;
+                while (end < current && !read_until.compare_exchange_weak(current, end)) {}
+            }
+        }
+    };
+
+    AccessAdvice previous = advice_;
+    Advise(AccessAdvice::kSequential);
+    std::latch helpers_done(static_cast<std::ptrdiff_t>(workers - 1));
+    GetReadWorkers().Run(workers - 1, [&]() {
+        worker();
+        helpers_done.count_down();
+    });
+    worker();
+    helpers_done.wait();
+    Advise(previous);
+
+    if (error != 0) {
+        errno = error;
+        RecordIOError();
+        return -1;
+    }
+    if (read_until < f_size) {
+        is_eof_ = true;
+    }
+    return static_cast<ssize_t>(read_until.load());
+}
+
+} // namespace wiseio
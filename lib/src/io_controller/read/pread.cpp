@@ -0,0 +1,67 @@
+#include <cerrno>  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <system_error>
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+// Не трогает cursor_, is_eof_ и кольцо io_uring: флаг EOF живет в стеке вызова,
+// а io_uring заменяется обычным pread, потому что кольцо нельзя делить между потоками
+ssize_t Stream::CorePRead(std::span<uint8_t> buffer, size_t offset) const {
+    bool is_eof = false;
+    switch (backend_) {
+        case (IOBackend::kMmap) : {
+            return wcore_mapped_custom_read(
+                backend_state_->map_data, backend_state_->map_size, buffer.data(), offset, buffer.size(), &is_eof);
+        }
+        case (IOBackend::kDirect) : {
+            return wcore_direct_custom_read(fd_, buffer.data(), offset, buffer.size(), &is_eof);
+        }
+        default : {
+            return wcore_custom_read(fd_, buffer.data(), offset, buffer.size(), &is_eof);
+        }
+    }
+}
+
+
+// Как и TryPRead, не пишет ошибку в стрим: закрытый стрим и неверный режим дают -1 и EBADF,
+// как pread на таком дескрипторе
+ssize_t Stream::PRead(std::span<uint8_t> buffer, size_t offset) const {
+    if (!IsOpen() || (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite)) {
+        errno = EBADF;
+        return -1;
+    }
+    return CorePRead(buffer, offset);
+}
+
+
+ssize_t Stream::PRead(std::span<std::byte> buffer, size_t offset) const {
+    return PRead(std::span<uint8_t>(
+        reinterpret_cast<uint8_t*>(buffer.data()), buffer.size()), offset);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+
+// Ошибка не записывается в стрим, чтобы вызов оставался безопасным для нескольких потоков
+IOResult Stream::TryPRead(std::span<uint8_t> buffer, size_t offset) const {
+    if (!IsOpen()) {
+        return std::unexpected(make_error_code(StreamError::kClosed));
+    }
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        return std::unexpected(make_error_code(StreamError::kWrongMode));
+    }
+    ssize_t len = CorePRead(buffer, offset);
+    if (len < 0) {
+        return std::unexpected(std::error_code(errno, std::generic_category()));
+    }
+    return static_cast<size_t>(len);
+}
+
+} // namespace wiseio
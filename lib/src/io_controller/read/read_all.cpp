@@ -17,15 +17,14 @@ namespace wiseio {
 ssize_t Stream::ReadAll(std::vector<uint8_t>& buffer) {
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
     size_t f_size = GetFileSize();
     buffer.resize(f_size);
 
-    ssize_t len = wcore_custom_read(
-        fd_, buffer.data(), 0, f_size,
-        &is_eof_);
+    ssize_t len = CoreReadAll(
+        buffer.data(), f_size);
     return len;
 }
 
@@ -33,34 +32,85 @@ ssize_t Stream::ReadAll(std::vector<uint8_t>& buffer) {
 ssize_t Stream::ReadAll(IOBuffer& buffer) {
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
     size_t f_size = GetFileSize();
     buffer.ResizeBuffer(f_size);
 
-    ssize_t len = wcore_custom_read(
-        fd_, buffer.GetDataPtr(), 0, f_size,
-        &is_eof_);
+    ssize_t len = CoreReadAll(
+        buffer.GetDataPtr(), f_size);
     return len;
 }
 
 ssize_t Stream::ReadAll(str& buffer) {
     FdCheck();
     if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме read");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
         return 0;
     }
 
+    size_t f_size = GetFileSize();
+    ssize_t len = 0;
+
+    // resize_and_overwrite не заполняет строку нулями перед чтением
+    buffer.resize_and_overwrite(f_size, [&](char* data, size_t size) {
+        len = CoreReadAll(
+            reinterpret_cast<uint8_t*>(data), size);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        return len > 0 ? static_cast<size_t>(len) : 0;
+    });
+
+    return len;
+}
+
+
+ssize_t Stream::ReadAll(std::vector<uint8_t>& buffer, const ParallelReadOptions& options) {
+    FdCheck();
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
+        return 0;
+    }
     size_t f_size = GetFileSize();
     buffer.resize(f_size);
 
-    ssize_t len = wcore_custom_read(
-        fd_, reinterpret_cast<uint8_t*>(buffer.data()), 0, f_size,  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-        &is_eof_);
+    ssize_t len = CoreReadAllParallel(
+        buffer.data(), f_size, options);
+    return len;
+}
+
+
+ssize_t Stream::ReadAll(IOBuffer& buffer, const ParallelReadOptions& options) {
+    FdCheck();
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
+        return 0;
+    }
+    size_t f_size = GetFileSize();
+    buffer.ResizeBuffer(f_size);
+
+    ssize_t len = CoreReadAllParallel(
+        buffer.GetDataPtr(), f_size, options);
+    return len;
+}
+
+
+ssize_t Stream::ReadAll(str& buffer, const ParallelReadOptions& options) {
+    FdCheck();
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме read");
+        return 0;
+    }
+
+    size_t f_size = GetFileSize();
+    ssize_t len = 0;
+
+    buffer.resize_and_overwrite(f_size, [&](char* data, size_t size) {
+        len = CoreReadAllParallel(
+            reinterpret_cast<uint8_t*>(data), size, options);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        return len > 0 ? static_cast<size_t>(len) : 0;
+    });
 
     return len;
 }
 
 } // namespace wiseio
-
@@ -0,0 +1,37 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <expected>
+#include <span>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+IOResult Stream::TryCRead(std::span<uint8_t> buffer) {
+    if (!IsOpen()) {
+        return std::unexpected(make_error_code(StreamError::kClosed));
+    }
+    ClearError();
+    ssize_t len = CRead(buffer);
+    if (len < 0 || last_error_ != StreamError::kNone) {
+        return std::unexpected(GetErrorCode());
+    }
+    return static_cast<size_t>(len);
+}
+
+
+IOResult Stream::TryCustomRead(std::span<uint8_t> buffer, size_t offset) {
+    if (!IsOpen()) {
+        return std::unexpected(make_error_code(StreamError::kClosed));
+    }
+    ClearError();
+    ssize_t len = CustomRead(buffer, offset);
+    if (len < 0 || last_error_ != StreamError::kNone) {
+        return std::unexpected(GetErrorCode());
+    }
+    return static_cast<size_t>(len);
+}
+
+} // namespace wiseio
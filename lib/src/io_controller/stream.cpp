@@ -9,6 +9,7 @@
 #include "wise-io/stream.hpp"
 #include "logging/logger.hpp"
 #include "wise-io/schemas.hpp"
+#include "wise-io/utils.hpp"
 
 
 namespace wiseio {
@@ -23,18 +24,33 @@ public:
 
 Stream::Stream(
         OpenMode io_mode,
-        const char* file_name)
+        const char* file_name,
+        IOBackend backend)
     : mode_(io_mode)
-    , file_path_(file_name) {}
+    , backend_(backend)
+    , file_path_(file_name)
+    , logger_(GetDefaultLogger()) {}
 
 
 Stream::Stream(Stream&& another) noexcept
         : fd_(another.fd_)
         , is_eof_(another.is_eof_)
+        , is_anonymous_(another.is_anonymous_)
+        , is_scratch_(std::exchange(another.is_scratch_, false))
         , mode_(another.mode_)
+        , backend_(another.backend_)
+        , durability_(another.durability_)
+        , advice_(another.advice_)
+        , backend_state_(std::move(another.backend_state_))
         , cursor_(another.cursor_)
+        , readahead_until_(another.readahead_until_)
+        , unsynced_size_(another.unsynced_size_.load())
+        , file_size_(another.file_size_.load())
+        , counters_(another.counters_)
+        , last_error_(another.last_error_)
+        , last_errno_(another.last_errno_)
         , file_path_(std::move(another.file_path_))
-        , logger_(std::move(another.logger_)) {
+        , logger_(another.logger_) {
 
     another.fd_ = -1;
 }
@@ -47,29 +63,51 @@ Stream& Stream::operator=(Stream&& another) noexcept {
 
     fd_ = another.fd_;
     is_eof_ = another.is_eof_;
+    is_anonymous_ = another.is_anonymous_;
+    is_scratch_ = std::exchange(another.is_scratch_, false);
     mode_ = another.mode_;
+    backend_ = another.backend_;
+    durability_ = another.durability_;
+    advice_ = another.advice_;
+    backend_state_ = std::move(another.backend_state_);  // прежнее кольцо и отображение освобождаются здесь
     cursor_ = another.cursor_;
+    readahead_until_ = another.readahead_until_;
+    unsynced_size_ = another.unsynced_size_.load();
+    file_size_ = another.file_size_.load();
+    counters_ = another.counters_;
     file_path_ = another.file_path_;
-    logger_ = std::move(another.logger_);
+    last_error_ = another.last_error_;
+    last_errno_ = another.last_errno_;
+    logger_ = another.logger_;
 
     another.fd_ = -1;
-    
+
     return *this;
 }
 
 
+// Проверка идет по отслеживаемому размеру, без fstat
 void Stream::SetCursor(size_t position) {
-    size_t fsize = GetFileSize();
-    if (position > fsize) {
+    ++counters_.cursor_moves;
+    if (position > file_size_) {
         throw segmentation_fault();
     }
     cursor_ = position;
 }
 
 
-void Stream::SetDelete() const {
-    if (IsOpen()) {
+void Stream::SetDelete() {
+    if (IsOpen() && !is_anonymous_) {
         wcore_unlink_file(file_path_.c_str());
+        is_scratch_ = false;
+    }
+}
+
+
+void Stream::DropScratch() {
+    if (is_scratch_) {
+        wcore_unlink_file(file_path_.c_str());
+        is_scratch_ = false;
     }
 }
 
@@ -89,26 +127,83 @@ bool Stream::IsOpen() const {
 }
 
 
+bool Stream::IsAnonymous() const {
+    return is_anonymous_;
+}
+
+
+OpenMode Stream::GetMode() const {
+    return mode_;
+}
+
+
+IOBackend Stream::GetBackend() const {
+    return backend_;
+}
+
+
 void Stream::FdCheck() const {
     if (fd_ == -1) {
-        logger_.Critical("Обращение к файлу через закрытый fd");
+        ReportError(StreamError::kClosed, "Обращение к файлу через закрытый fd");
         throw std::runtime_error("fd error");
     }
 }
 
 void Stream::Rename(str&& new_name) {
+    if (is_anonymous_) {
+        ReportError(StreamError::kWrongState, "У безымянного файла нет имени, сначала нужен Link");
+        return;
+    }
+    if (durability_ == Durability::kFull && IsOpen()) {
+        wcore_fsync(fd_);
+    }
     std::filesystem::rename(file_path_, file_path_.parent_path() / std::move(new_name));
+    is_scratch_ = false;
+
+    if (durability_ == Durability::kFull) {
+        std::filesystem::path dir = file_path_.parent_path();
+        wcore_sync_dir(dir.empty() ? "." : dir.c_str());
+    }
+}
+
+
+bool Stream::Link(const std::filesystem::path& path) {
+    FdCheck();
+    if (!is_anonymous_) {
+        ReportError(StreamError::kWrongState, "Link доступен только для файлов из CreateTempStream");
+        return false;
+    }
+    if (durability_ == Durability::kFull) {
+        wcore_fsync(fd_);
+    }
+    if (!wcore_link_tmpfile(fd_, path.c_str())) {
+        return false;
+    }
+    file_path_ = path;
+    is_anonymous_ = false;
+
+    if (durability_ == Durability::kFull) {
+        std::filesystem::path dir = file_path_.parent_path();
+        wcore_sync_dir(dir.empty() ? "." : dir.c_str());
+    }
+    return true;
 }
 
 
 void Stream::Close() {
+    SyncOnClose();
+    ReleaseBackend();
     wcore_close(fd_);
     fd_ = -1;
+    DropScratch();
 }
 
 
 Stream::~Stream() {
+    SyncOnClose();
+    ReleaseBackend();
     wcore_close(fd_);
+    DropScratch();
 }
 
 
@@ -120,7 +215,10 @@ bool Stream::Open() {
             break;
         }
         case (OpenMode::kWrite) : {
-            fd_ = wcore_o_write(file_path_.c_str());
+            // O_DIRECT пишет невыровненные края блоков через read-modify-write, ядру нужно право чтения
+            fd_ = backend_ == IOBackend::kDirect
+                ? wcore_read_and_write(file_path_.c_str())
+                : wcore_o_write(file_path_.c_str());
             break;
         }
         case (OpenMode::kAppend) : {
@@ -131,26 +229,30 @@ bool Stream::Open() {
             fd_ = wcore_read_and_write(file_path_.c_str());
             break;
         } case (OpenMode::kDefault) : {
-            logger_.Error("Не задан режим открытия");
+            ReportError(StreamError::kWrongMode, "Не задан режим открытия");
         }
     }
 
     if (fd_ >= 0) {
-        logger_.Debug("Файл открыт в режиме " + std::to_string(
-            static_cast<int>(mode_)));
+        if (logger_ != nullptr) {
+            logger_->Debug("Файл открыт в режиме " + std::to_string(
+                static_cast<int>(mode_)));
+        }
+        RefreshFileSize();
+        InitBackend();
         return true;
     } 
 
-    logger_.Error("Ошибка при открытии файла. FD: " + std::to_string(
-        fd_) + " Errno: " + std::to_string(errno));
+    last_errno_ = errno;
+    ReportError(StreamError::kOpen, "Ошибка при открытии файла. FD: " + std::to_string(
+        fd_) + " Errno: " + std::to_string(last_errno_));
     return false;
 }
 
 
-Stream CreateStream(const char* name, OpenMode mode, bool is_temp) {
-    Stream stream (mode, name);
+Stream CreateStream(const char* name, OpenMode mode, bool is_temp, IOBackend backend) {
+    Stream stream (mode, name, backend);
 
-    stream.logger_ = logging::Logger {name};
     bool state = stream.Open();
 
     if (!state) {
@@ -163,10 +265,9 @@ Stream CreateStream(const char* name, OpenMode mode, bool is_temp) {
 }
 
 
-Stream CreateStream(const std::filesystem::path& name, OpenMode mode, bool is_temp) {
-    Stream stream {mode, name.c_str()};
+Stream CreateStream(const std::filesystem::path& name, OpenMode mode, bool is_temp, IOBackend backend) {
+    Stream stream {mode, name.c_str(), backend};
 
-    stream.logger_ = logging::Logger {name};
     bool state = stream.Open();
 
     if (!state) {
@@ -179,5 +280,27 @@ Stream CreateStream(const std::filesystem::path& name, OpenMode mode, bool is_te
 }
 
 
+Stream CreateTempStream(const std::filesystem::path& dir, IOBackend backend) {
+    std::filesystem::path dir_path = dir.empty() ? "." : dir;
+    Stream stream {OpenMode::kReadAndWrite, dir_path.c_str(), backend};
+
+    stream.fd_ = wcore_o_tmpfile(dir_path.c_str());
+    if (stream.fd_ >= 0) {
+        stream.is_anonymous_ = true;
+        stream.InitBackend();
+        return stream;
+    }
+
+    // Файловая система без O_TMPFILE: обычный файл с уникальным именем, который удаляется
+    // при закрытии, как безымянный, пока его не забрал Rename
+    if (stream.logger_ != nullptr) {
+        stream.logger_->Debug("O_TMPFILE не поддерживается, создается именованный файл");
+    }
+    Stream named = CreateStream(dir_path / FileNamer::GetName(), OpenMode::kReadAndWrite, false, backend);
+    named.is_scratch_ = true;
+    return named;
+}
+
+
 } // namespace wiseio
 
@@ -0,0 +1,219 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "wise-io/pool.hpp"
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+using str = std::string;
+
+namespace wiseio {
+
+StreamPool::StreamPool(size_t capacity)
+        : capacity_(capacity) {}
+
+
+str StreamPool::MakeKey(const std::filesystem::path& path, OpenMode mode, IOBackend backend) {
+    str key = path.native();
+    key.push_back('\0');
+    key.push_back(static_cast<char>(mode));
+    key.push_back(static_cast<char>(backend));
+    return key;
+}
+
+
+// Закрывает неарендованные стримы с хвоста LRU, пока открыто больше limit
+void StreamPool::Evict(size_t limit) {
+    auto it = lru_.end();
+    while (entries_.size() > limit && it != lru_.begin()) {
+        --it;
+        auto entry = entries_.find(*it);
+        if (entry->second.leases > 0) {
+            continue;
+        }
+        entries_.erase(entry);
+        it = lru_.erase(it);
+        ++counters_.evictions;
+    }
+}
+
+
+void StreamPool::Release(Entry* entry) {
+    std::lock_guard lock(mutex_);
+    --entry->leases;
+    if (entry->leases > 0) {
+        return;
+    }
+    if (entry->is_stale) {
+        auto position = entry->position;
+        entries_.erase(*position);
+        lru_.erase(position);
+        ++counters_.evictions;
+        return;
+    }
+    Evict(capacity_);
+}
+
+
+// Переименовывает ключ, чтобы новые Acquire открыли файл заново, и возвращает узел в таблицу
+void StreamPool::MarkStale(std::unordered_map<str, Entry>::node_type&& node) {
+    Entry& entry = node.mapped();
+    entry.is_stale = true;
+    node.key().append(":stale:" + std::to_string(++stale_keys_));
+    *entry.position = node.key();
+    entries_.insert(std::move(node));
+}
+
+
+// Файл открывается без мьютекса: промах не задерживает потоки, которые попадают в кэш.
+// Если тот же файл за это время открыл другой поток, берется его стрим, а свой закрывается
+StreamLease StreamPool::Acquire(const std::filesystem::path& path, OpenMode mode, IOBackend backend) {
+    str key = MakeKey(path, mode, backend);
+    size_t invalidations = 0;
+    {
+        std::lock_guard lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            Entry& entry = it->second;
+            ++counters_.hits;
+            ++entry.leases;
+            lru_.splice(lru_.begin(), lru_, entry.position);
+            return {this, &entry};
+        }
+        ++counters_.misses;
+        invalidations = invalidations_;
+    }
+
+    Stream stream = CreateStream(path, mode, false, backend);
+
+    // Объявлен после stream, поэтому мьютекс отпускается раньше, чем закрывается лишний стрим
+    std::lock_guard lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        Entry& entry = it->second;
+        ++entry.leases;
+        lru_.splice(lru_.begin(), lru_, entry.position);
+        return {this, &entry};
+    }
+
+    Evict(capacity_ > 0 ? capacity_ - 1 : 0);
+    lru_.push_front(key);
+    auto [inserted, _] = entries_.try_emplace(
+        key, Entry {std::move(stream), path.lexically_normal(), lru_.begin(), 1, false});
+
+    // Invalidate во время открытия мог относиться к этому файлу: стрим отдается, но не кэшируется
+    if (invalidations != invalidations_) {
+        auto node = entries_.extract(inserted);
+        Entry& entry = node.mapped();
+        MarkStale(std::move(node));
+        return {this, &entry};
+    }
+    return {this, &inserted->second};
+}
+
+
+// Арендованные стримы получают уникальный ключ: новые Acquire откроют файл заново,
+// а старый стрим закроется вместе с последней арендой
+void StreamPool::Invalidate(const std::filesystem::path& path) {
+    std::lock_guard lock(mutex_);
+    ++invalidations_;
+    std::filesystem::path normal = path.lexically_normal();
+
+    std::vector<str> keys;
+    for (const auto& [key, entry] : entries_) {
+        if (!entry.is_stale && entry.path == normal) {
+            keys.push_back(key);
+        }
+    }
+
+    for (const str& key : keys) {
+        auto node = entries_.extract(key);
+        Entry& entry = node.mapped();
+        if (entry.leases == 0) {
+            lru_.erase(entry.position);
+            ++counters_.evictions;
+            continue;
+        }
+        MarkStale(std::move(node));
+    }
+}
+
+
+void StreamPool::Clear() {
+    std::lock_guard lock(mutex_);
+    Evict(0);
+}
+
+
+size_t StreamPool::GetOpenCount() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+
+size_t StreamPool::GetCapacity() const {
+    return capacity_;
+}
+
+
+StreamPoolCounters StreamPool::GetCounters() const {
+    std::lock_guard lock(mutex_);
+    return counters_;
+}
+
+
+StreamLease::StreamLease(StreamPool* pool, StreamPool::Entry* entry)
+        : pool_(pool)
+        , entry_(entry) {}
+
+
+StreamLease::StreamLease(StreamLease&& another) noexcept
+        : pool_(std::exchange(another.pool_, nullptr))
+        , entry_(std::exchange(another.entry_, nullptr)) {}
+
+
+StreamLease& StreamLease::operator=(StreamLease&& another) noexcept {
+    if (this != &another) {
+        Release();
+        pool_ = std::exchange(another.pool_, nullptr);
+        entry_ = std::exchange(another.entry_, nullptr);
+    }
+    return *this;
+}
+
+
+Stream& StreamLease::Get() {
+    return entry_->stream;
+}
+
+
+Stream& StreamLease::operator*() {
+    return entry_->stream;
+}
+
+
+Stream* StreamLease::operator->() {
+    return &entry_->stream;
+}
+
+
+void StreamLease::Release() {
+    if (pool_ != nullptr) {
+        pool_->Release(entry_);
+    }
+    pool_ = nullptr;
+    entry_ = nullptr;
+}
+
+
+StreamLease::~StreamLease() {
+    Release();
+}
+
+} // namespace wiseio
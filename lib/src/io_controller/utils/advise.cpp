@@ -0,0 +1,68 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+// Режимы kNormal, kSequential и kRandom для всего файла запоминаются,
+// чтобы временная подсказка ReadAll могла вернуть предыдущий
+bool Stream::Advise(AccessAdvice advice, size_t offset, size_t size) {
+    if (!IsOpen()) {
+        return false;
+    }
+    if (offset == 0 && size == 0 && advice <= AccessAdvice::kRandom) {
+        advice_ = advice;
+    }
+
+    switch (backend_) {
+        case (IOBackend::kDirect) : {
+            return true;  // O_DIRECT обходит page cache, подсказывать нечего
+        }
+        case (IOBackend::kMmap) : {
+            return wcore_madvise(
+                backend_state_->map_data, backend_state_->map_size, static_cast<wcore_advice_t>(advice), offset, size);
+        }
+        default : {
+            return wcore_fadvise(
+                fd_, static_cast<wcore_advice_t>(advice), offset, size);
+        }
+    }
+}
+
+
+AccessAdvice Stream::GetAdvice() const {
+    return advice_;
+}
+
+
+// Одна подсказка WILLNEED на окно kReadAheadWindow вперед, а не на каждый CRead.
+// После Advise(kRandom) упреждающее чтение выключено пользователем и не навязывается
+void Stream::AdviseReadAhead(size_t buffer_size) {
+    if (advice_ == AccessAdvice::kRandom || cursor_ + buffer_size <= readahead_until_) {
+        return;
+    }
+    readahead_until_ = cursor_ + buffer_size + kReadAheadWindow;
+    Advise(AccessAdvice::kWillNeed, cursor_, readahead_until_ - cursor_);
+    ++counters_.readahead_hints;
+}
+
+
+ssize_t Stream::CoreReadAll(uint8_t* buffer, size_t f_size) {
+    if (f_size < kReadAheadWindow) {
+        return CoreCustomRead(buffer, 0, f_size);
+    }
+
+    AccessAdvice previous = advice_;
+    Advise(AccessAdvice::kSequential);
+    ssize_t len = CoreCustomRead(buffer, 0, f_size);
+    Advise(previous);
+
+    return len;
+}
+
+} // namespace wiseio
@@ -0,0 +1,210 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+Stream::BackendState::~BackendState() {
+    wcore_uring_destroy(ring);
+    wcore_unmap_file(map_data, map_size);
+}
+
+
+void Stream::InitBackend() {
+    switch (backend_) {
+        case (IOBackend::kSync) : {
+            break;
+        }
+        case (IOBackend::kIOUring) : {
+            if (backend_state_ != nullptr) {
+                break;
+            }
+            wcore_uring* ring = wcore_uring_create(WCORE_URING_DEFAULT_ENTRIES);
+            if (ring == nullptr) {
+                LogFallback("io_uring недоступен, используется синхронный backend. Errno: "
+                    + std::to_string(errno));
+                backend_ = IOBackend::kSync;
+                break;
+            }
+            backend_state_ = std::make_unique<BackendState>();
+            backend_state_->ring = ring;
+            break;
+        }
+        case (IOBackend::kMmap) : {
+            if (mode_ != OpenMode::kRead) {
+                LogFallback("mmap backend доступен только в режиме read, используется синхронный backend");
+                backend_ = IOBackend::kSync;
+                break;
+            }
+            // пустой файл отображать нечего: map_data остается nullptr, все чтения сразу дают EOF
+            auto state = std::make_unique<BackendState>();
+            if (!wcore_map_file(fd_, &state->map_data, &state->map_size)) {
+                LogFallback("Ошибка mmap, используется синхронный backend. Errno: "
+                    + std::to_string(errno));
+                backend_ = IOBackend::kSync;
+                break;
+            }
+            backend_state_ = std::move(state);
+            break;
+        }
+        case (IOBackend::kDirect) : {
+            // O_APPEND + O_DIRECT требует выровненного конца файла, дозапись идет через page cache
+            if (mode_ == OpenMode::kAppend) {
+                LogFallback("O_DIRECT недоступен в режиме append, используется синхронный backend");
+                backend_ = IOBackend::kSync;
+                break;
+            }
+            if (!wcore_set_direct(fd_, true)) {
+                LogFallback("Файловая система не поддерживает O_DIRECT, используется синхронный backend. Errno: "
+                    + std::to_string(errno));
+                backend_ = IOBackend::kSync;
+            }
+            break;
+        }
+    }
+}
+
+
+void Stream::ReleaseBackend() {
+    backend_state_.reset();
+}
+
+
+std::span<const uint8_t> Stream::GetMappedView(size_t offset, size_t size) const {
+    if (backend_ != IOBackend::kMmap) {
+        ReportError(StreamError::kWrongState, "Для использования этого метода стрим должен быть открыт с mmap backend");
+        return {};
+    }
+    // после Close отображения уже нет
+    if (backend_state_ == nullptr || offset >= backend_state_->map_size) {
+        return {};
+    }
+    const BackendState& state = *backend_state_;
+    return std::span<const uint8_t>(state.map_data + offset, std::min(size, state.map_size - offset));  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+
+ssize_t Stream::CoreCRead(uint8_t* buffer, size_t buffer_size) {
+    AdviseReadAhead(buffer_size);
+
+    ssize_t len = 0;
+    switch (backend_) {
+        case (IOBackend::kIOUring) : {
+            len = wcore_uring_cread(backend_state_->ring, fd_, buffer, buffer_size, &is_eof_, &cursor_);
+            break;
+        }
+        case (IOBackend::kMmap) : {
+            len = wcore_mapped_cread(backend_state_->map_data, backend_state_->map_size, buffer, buffer_size, &is_eof_, &cursor_);
+            break;
+        }
+        case (IOBackend::kDirect) : {
+            len = wcore_direct_cread(fd_, buffer, buffer_size, &is_eof_, &cursor_);
+            break;
+        }
+        default : {
+            len = wcore_cread(fd_, buffer, buffer_size, &is_eof_, &cursor_);
+        }
+    }
+    if (len < 0) {
+        RecordIOError();
+    }
+    return len;
+}
+
+
+ssize_t Stream::CoreCustomRead(uint8_t* buffer, size_t offset, size_t buffer_size) {
+    ssize_t len = 0;
+    switch (backend_) {
+        case (IOBackend::kIOUring) : {
+            len = wcore_uring_custom_read(backend_state_->ring, fd_, buffer, offset, buffer_size, &is_eof_);
+            break;
+        }
+        case (IOBackend::kMmap) : {
+            len = wcore_mapped_custom_read(backend_state_->map_data, backend_state_->map_size, buffer, offset, buffer_size, &is_eof_);
+            break;
+        }
+        case (IOBackend::kDirect) : {
+            len = wcore_direct_custom_read(fd_, buffer, offset, buffer_size, &is_eof_);
+            break;
+        }
+        default : {
+            len = wcore_custom_read(fd_, buffer, offset, buffer_size, &is_eof_);
+        }
+    }
+    if (len < 0) {
+        RecordIOError();
+    }
+    return len;
+}
+
+
+bool Stream::CoreCWrite(const uint8_t* buffer, size_t buffer_size) {
+    bool state = false;
+    switch (backend_) {
+        case (IOBackend::kIOUring) : {
+            state = wcore_uring_cwrite(backend_state_->ring, fd_, buffer, buffer_size, &cursor_);
+            break;
+        }
+        case (IOBackend::kDirect) : {
+            state = wcore_direct_cwrite(fd_, buffer, buffer_size, &cursor_);
+            break;
+        }
+        default : {
+            state = wcore_cwrite(fd_, buffer, buffer_size, &cursor_);
+        }
+    }
+    if (state) {
+        TrackWrite(cursor_ - buffer_size, buffer_size);
+    } else {
+        RecordIOError();
+    }
+    return state;
+}
+
+
+bool Stream::CoreCustomWrite(const uint8_t* buffer, size_t offset, size_t buffer_size) {
+    bool state = false;
+    switch (backend_) {
+        case (IOBackend::kIOUring) : {
+            state = wcore_uring_custom_write(backend_state_->ring, fd_, buffer, offset, buffer_size);
+            break;
+        }
+        case (IOBackend::kDirect) : {
+            state = wcore_direct_custom_write(fd_, buffer, offset, buffer_size);
+            break;
+        }
+        default : {
+            state = wcore_custom_write(fd_, buffer, offset, buffer_size);
+        }
+    }
+    if (state) {
+        TrackWrite(offset, buffer_size);
+    } else {
+        RecordIOError();
+    }
+    return state;
+}
+
+
+bool Stream::CoreAWrite(const uint8_t* buffer, size_t buffer_size) {
+    bool state = wcore_awrite(fd_, buffer, buffer_size);
+    if (state) {
+        TrackAppend(buffer_size);
+    } else {
+        RecordIOError();
+    }
+    return state;
+}
+
+} // namespace wiseio
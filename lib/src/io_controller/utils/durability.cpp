@@ -0,0 +1,66 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <cstddef>
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+void Stream::SetDurability(Durability durability) {
+    durability_ = durability;
+    unsynced_size_ = 0;
+}
+
+
+Durability Stream::GetDurability() const {
+    return durability_;
+}
+
+
+void Stream::TrackWrite(size_t offset, size_t size) {
+    size_t end = offset + size;
+    size_t file_size = file_size_.load(std::memory_order_relaxed);
+    while (file_size < end && !file_size_.compare_exchange_weak(file_size, end, std::memory_order_relaxed)) {}
+
+    if (durability_ != Durability::kWriteBehind) {
+        return;
+    }
+    // Сброс запускает тот, кто обнулил счетчик, параллельные записи его не повторяют
+    size_t unsynced = unsynced_size_.fetch_add(size, std::memory_order_relaxed) + size;
+    if (unsynced >= kWriteBehindWindow && unsynced_size_.compare_exchange_strong(unsynced, 0, std::memory_order_relaxed)) {
+        wcore_write_behind(fd_);
+    }
+}
+
+
+// Дозапись с O_APPEND: ядро пишет в текущий конец файла, размер растет на size даже при параллельных вызовах
+void Stream::TrackAppend(size_t size) {
+    size_t end = file_size_.fetch_add(size, std::memory_order_relaxed) + size;
+    TrackWrite(end - size, size);
+}
+
+
+void Stream::SyncOnClose() {
+    if (!IsOpen() || mode_ == OpenMode::kRead) {
+        return;
+    }
+    switch (durability_) {
+        case (Durability::kSyncOnClose) :
+        case (Durability::kWriteBehind) : {
+            wcore_sync(fd_);
+            break;
+        }
+        case (Durability::kFull) : {
+            wcore_fsync(fd_);
+            break;
+        }
+        default : {
+            break;
+        }
+    }
+}
+
+} // namespace wiseio
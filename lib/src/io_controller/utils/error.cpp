@@ -0,0 +1,132 @@
+#include <cerrno>  // Copyright 2025 wiserin
+#include <string>
+#include <system_error>
+
+#include "logging/logger.hpp"
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+using str = std::string;
+
+namespace wiseio {
+
+namespace {
+
+class StreamErrorCategory : public std::error_category {
+ public:
+    [[nodiscard]] const char* name() const noexcept override {
+        return "wiseio::Stream";
+    }
+
+    [[nodiscard]] str message(int value) const override {
+        switch (static_cast<StreamError>(value)) {
+            case (StreamError::kNone) : return "no error";
+            case (StreamError::kOpen) : return "file open failed";
+            case (StreamError::kClosed) : return "stream is closed";
+            case (StreamError::kWrongMode) : return "operation not allowed in this open mode";
+            case (StreamError::kWrongState) : return "operation not allowed for this backend or stream state";
+            case (StreamError::kIO) : return "I/O error";
+        }
+        return "unknown error";
+    }
+};
+
+} // namespace
+
+
+const std::error_category& StreamCategory() {
+    static const StreamErrorCategory category;
+    return category;
+}
+
+
+std::error_code make_error_code(StreamError error) {
+    return {static_cast<int>(error), StreamCategory()};
+}
+
+
+// Сообщение собирается только здесь, проверки в горячих путях сводятся к сравнению и вызову
+void Stream::ReportError(StreamError error, const str& message) const {
+    last_error_ = error;
+    if (logger_ == nullptr) {
+        return;
+    }
+
+    str text = file_path_.string() + ": " + message;
+    switch (error) {
+        case (StreamError::kWrongMode) :
+        case (StreamError::kWrongState) : {
+            logger_->Exception(text);
+            break;
+        }
+        case (StreamError::kClosed) : {
+            logger_->Critical(text);
+            break;
+        }
+        default : {
+            logger_->Error(text);
+        }
+    }
+}
+
+
+// errno сохраняется сразу: логгер может его перезаписать
+void Stream::RecordIOError() const {
+    int error = errno;
+    last_errno_ = error;
+    ReportError(StreamError::kIO, "Ошибка ввода-вывода. Errno: " + std::to_string(error));
+}
+
+
+void Stream::LogFallback(const str& message) const {
+    if (logger_ != nullptr) {
+        logger_->Error(file_path_.string() + ": " + message);
+    }
+}
+
+
+StreamError Stream::GetLastError() const {
+    return last_error_;
+}
+
+
+std::error_code Stream::GetErrorCode() const {
+    if ((last_error_ == StreamError::kIO || last_error_ == StreamError::kOpen) && last_errno_ != 0) {
+        return {last_errno_, std::generic_category()};
+    }
+    return make_error_code(last_error_);
+}
+
+
+void Stream::ClearError() {
+    last_error_ = StreamError::kNone;
+    last_errno_ = 0;
+}
+
+
+void Stream::SetLogger(const logging::Logger* logger) {
+    logger_ = logger;
+}
+
+
+void Stream::SetDefaultLogger(const logging::Logger* logger) {
+    default_logger = logger;
+    is_default_logger_set = true;
+}
+
+
+const logging::Logger& Stream::GetSharedLogger() {
+    static const logging::Logger logger {"wiseio"};
+    return logger;
+}
+
+
+const logging::Logger* Stream::GetDefaultLogger() {
+    if (is_default_logger_set) {
+        return default_logger;
+    }
+    return &GetSharedLogger();
+}
+
+} // namespace wiseio
@@ -0,0 +1,21 @@
+#include <cstddef>  // Copyright 2025 wiserin
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+bool Stream::Reserve(size_t size) {
+    FdCheck();
+    if (mode_ == OpenMode::kRead) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
+        return false;
+    }
+
+    return wcore_reserve(fd_, size);
+}
+
+} // namespace wiseio
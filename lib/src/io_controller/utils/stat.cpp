@@ -8,13 +8,28 @@
 
 namespace wiseio {
 
+// Размер отслеживается записями этого стрима. Изменения файла со стороны
+// подхватываются только через RefreshFileSize
 size_t Stream::GetFileSize() const {
     FdCheck();
+    return file_size_;
+}
+
+
+size_t Stream::RefreshFileSize() {
+    FdCheck();
 
     stat_t file_stat;
-    wcore_update_stat(fd_, &file_stat);  // TODO обновлять только при изменениях
+    wcore_update_stat(fd_, &file_stat);
+    ++counters_.stat_calls;
+    file_size_ = file_stat.st_size;
+
+    return file_size_;
+}
+
 
-    return file_stat.st_size;
+const StreamCounters& Stream::GetCounters() const {
+    return counters_;
 }
 
 } // namespace wiseio
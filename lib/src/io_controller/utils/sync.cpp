@@ -0,0 +1,13 @@
+#include <core.h>  // Copyright 2025 wiserin
+
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+bool Stream::Sync() {
+    FdCheck();
+    return wcore_sync(fd_);
+}
+
+} // namespace wiseio
@@ -1,4 +1,6 @@
-#include <cstdint>  // Copyright 2025 wiserin
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -15,34 +17,51 @@ namespace wiseio {
 
 bool Stream::AWrite(const std::vector<uint8_t>& buffer) {
     if (mode_ != OpenMode::kAppend) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Append");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Append");
         return false;
     }
-    bool state = wcore_awrite(
-        fd_, buffer.data(), buffer.size());
+    bool state = CoreAWrite(
+        buffer.data(), buffer.size());
     return state;
 }
 
 
 bool Stream::AWrite(const IOBuffer& buffer) {
     if (mode_ != OpenMode::kAppend) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Append");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Append");
         return false;
     }
-    bool state = wcore_awrite(
-        fd_, buffer.GetDataPtr(), buffer.GetBufferSize());
+    bool state = CoreAWrite(
+        buffer.GetDataPtr(), buffer.GetBufferSize());
     return state;
 }
 
 
 bool Stream::AWrite(const str& buffer) {
     if (mode_ != OpenMode::kAppend) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Append");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Append");
         return false;
     }
-    bool state = wcore_awrite(
-        fd_, reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    bool state = CoreAWrite(
+        reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
     return state;
 }
 
+
+bool Stream::AWrite(std::span<const uint8_t> buffer) {
+    if (mode_ != OpenMode::kAppend) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Append");
+        return false;
+    }
+    bool state = CoreAWrite(
+        buffer.data(), buffer.size());
+    return state;
+}
+
+
+bool Stream::AWrite(std::span<const std::byte> buffer) {
+    return AWrite(std::span<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
 } // namespace wiseio
@@ -0,0 +1,85 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+bool Stream::CustomWrite(const std::vector<WriteSegment>& segments) {
+    if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
+        return false;
+    }
+
+    // ядро только читает из буферов, const_cast нужен лишь для общего с чтением формата сегмента
+    std::vector<wcore_segment_t> core_segments;
+    core_segments.reserve(segments.size());
+    for (const WriteSegment& segment : segments) {
+        core_segments.push_back({
+            const_cast<uint8_t*>(segment.buffer.data()),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            segment.buffer.size(), segment.offset, 0});
+    }
+
+    bool state = true;
+    switch (backend_) {
+        case (IOBackend::kIOUring) : {
+            state = wcore_uring_custom_write_batch(
+                backend_state_->ring, fd_, core_segments.data(), core_segments.size());
+            break;
+        }
+        case (IOBackend::kDirect) : {
+            for (const wcore_segment_t& segment : core_segments) {
+                state = state && wcore_direct_custom_write(
+                    fd_, segment.buffer, segment.offset, segment.buffer_size);
+            }
+            break;
+        }
+        default : {
+            state = wcore_custom_writev(
+                fd_, core_segments.data(), core_segments.size());
+        }
+    }
+    if (!state) {
+        RecordIOError();
+        return false;
+    }
+    for (const wcore_segment_t& segment : core_segments) {
+        TrackWrite(segment.offset, segment.buffer_size);
+    }
+    return state;
+}
+
+
+bool Stream::AWrite(const std::vector<std::span<const uint8_t>>& buffers) {
+    if (mode_ != OpenMode::kAppend) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Append");
+        return false;
+    }
+
+    std::vector<wcore_segment_t> core_segments;
+    core_segments.reserve(buffers.size());
+    for (const std::span<const uint8_t>& buffer : buffers) {
+        core_segments.push_back({
+            const_cast<uint8_t*>(buffer.data()),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            buffer.size(), 0, 0});
+    }
+
+    bool state = wcore_awritev(
+        fd_, core_segments.data(), core_segments.size());
+    if (!state) {
+        RecordIOError();
+        return false;
+    }
+    for (const wcore_segment_t& segment : core_segments) {
+        TrackAppend(segment.buffer_size);
+    }
+    return state;
+}
+
+} // namespace wiseio
@@ -0,0 +1,178 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "wise-io/buffer.hpp"
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+#include "wise-io/writer.hpp"
+
+
+using str = std::string;
+
+namespace wiseio {
+
+BufferedWriter::BufferedWriter(Stream& stream, size_t capacity, bool is_async)
+        : stream_(stream)
+        , capacity_(AlignedIOBuffer::RoundUp(
+            std::max<size_t>(capacity, 1), AlignedIOBuffer::kDefaultAlignment))
+        , is_async_(is_async) {
+
+    active_.ResizeBuffer(capacity_);
+    active_.ResizeBuffer(0);
+    if (is_async_) {
+        pending_.ResizeBuffer(capacity_);
+        pending_.ResizeBuffer(0);
+        worker_ = std::thread(&BufferedWriter::Worker, this);
+    }
+}
+
+
+bool BufferedWriter::WriteOut(std::span<const uint8_t> buffer) {
+    if (stream_.GetMode() == OpenMode::kAppend) {
+        return stream_.AWrite(buffer);
+    }
+    return stream_.CWrite(buffer);
+}
+
+
+// Фоновый поток пишет pending_, пока основной заполняет active_
+void BufferedWriter::Worker() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this]() { return is_pending_ || is_stopped_; });
+        if (!is_pending_) {
+            return;
+        }
+
+        lock.unlock();
+        bool state = WriteOut({pending_.GetDataPtr(), pending_.GetBufferSize()});
+        lock.lock();
+
+        if (!state) {
+            is_failed_ = true;
+        }
+        is_pending_ = false;
+        pending_.ResizeBuffer(0);
+        cv_.notify_all();
+    }
+}
+
+
+bool BufferedWriter::WaitPending() {
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this]() { return !is_pending_; });
+    return !is_failed_;
+}
+
+
+bool BufferedWriter::FlushActive() {
+    if (filled_ == 0) {
+        return WaitPending();
+    }
+    active_.ResizeBuffer(filled_);
+    filled_ = 0;
+
+    if (!is_async_) {
+        bool state = WriteOut({active_.GetDataPtr(), active_.GetBufferSize()});
+        active_.ResizeBuffer(0);
+        if (!state) {
+            is_failed_ = true;
+        }
+        return state;
+    }
+
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this]() { return !is_pending_; });
+    std::swap(active_, pending_);
+    active_.ResizeBuffer(0);
+    is_pending_ = true;
+    cv_.notify_all();
+
+    return !is_failed_;
+}
+
+
+bool BufferedWriter::Write(std::span<const uint8_t> buffer) {
+    // Частый случай: запись целиком помещается в свободную часть буфера
+    if (buffer.size() < capacity_ - filled_) {
+        std::memcpy(active_.GetDataPtr() + filled_, buffer.data(), buffer.size());  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        filled_ += buffer.size();
+        return !is_failed_;
+    }
+
+    while (!buffer.empty()) {
+        // Крупный кусок при пустом буфере уходит в Stream без копирования
+        if (filled_ == 0 && buffer.size() >= capacity_) {
+            if (!WaitPending()) {
+                return false;
+            }
+            bool state = WriteOut(buffer);
+            if (!state) {
+                is_failed_ = true;
+            }
+            return state;
+        }
+
+        size_t take = std::min(capacity_ - filled_, buffer.size());
+        std::memcpy(active_.GetDataPtr() + filled_, buffer.data(), take);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        filled_ += take;
+        buffer = buffer.subspan(take);
+
+        if (filled_ == capacity_ && !FlushActive()) {
+            return false;
+        }
+    }
+
+    return !is_failed_;
+}
+
+
+bool BufferedWriter::Write(const str& buffer) {
+    return Write(std::span<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+
+bool BufferedWriter::Flush() {
+    if (!FlushActive()) {
+        return false;
+    }
+    return WaitPending();
+}
+
+
+size_t BufferedWriter::GetBuffered() const {
+    return filled_;
+}
+
+
+size_t BufferedWriter::GetCapacity() const {
+    return capacity_;
+}
+
+
+Stream& BufferedWriter::GetStream() {
+    return stream_;
+}
+
+
+BufferedWriter::~BufferedWriter() {
+    Flush();
+    if (worker_.joinable()) {
+        {
+            std::lock_guard lock(mutex_);
+            is_stopped_ = true;
+        }
+        cv_.notify_all();
+        worker_.join();
+    }
+}
+
+} // namespace wiseio
@@ -0,0 +1,56 @@
+#include <algorithm>  // Copyright 2025 wiserin
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+#include <vector>
+
+#include <core.h>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+bool Stream::CopyRange(Stream& destination, size_t offset, size_t size, size_t destination_offset) {
+    FdCheck();
+    destination.FdCheck();
+    if (mode_ != OpenMode::kRead && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Read");
+        return false;
+    }
+    if (destination.mode_ != OpenMode::kWrite && destination.mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл назначения должен быть открыт в режиме Write");
+        return false;
+    }
+
+    ssize_t copied = wcore_copy_range(fd_, offset, destination.fd_, destination_offset, size);
+    if (copied < 0) {
+        RecordIOError();
+        return false;
+    }
+    destination.TrackWrite(destination_offset, copied);
+
+    // Ядро не умеет копировать между этими файлами, остаток переносится через буфер
+    size_t done = copied;
+    std::vector<uint8_t> buffer;
+    while (done < size) {
+        buffer.resize(std::min(kCopyBufferSize, size - done));
+        ssize_t res = CoreCustomRead(buffer.data(), offset + done, buffer.size());
+        if (res <= 0) {
+            break;
+        }
+        if (!destination.CoreCustomWrite(buffer.data(), destination_offset + done, res)) {
+            return false;
+        }
+        done += res;
+    }
+
+    if (done < size) {
+        ReportError(StreamError::kIO, "Исходный файл закончился раньше копируемого диапазона");
+        return false;
+    }
+    return true;
+}
+
+} // namespace wiseio
@@ -1,5 +1,6 @@
 #include <cstddef>  // Copyright 2025 wiserin
 #include <cstdint>
+#include <span>
 #include <string>
 #include <sys/types.h>
 #include <vector>
@@ -15,35 +16,52 @@ using str = std::string;
 
 namespace wiseio {
 
-bool Stream::CustomWrite(const std::vector<uint8_t>& buffer, size_t offset) const {
+bool Stream::CustomWrite(const std::vector<uint8_t>& buffer, size_t offset) {
     if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Write");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
         return false;
     }
-    bool state = wcore_custom_write(
-        fd_, buffer.data(), offset, buffer.size());
+    bool state = CoreCustomWrite(
+        buffer.data(), offset, buffer.size());
     return state;
 }
 
 
-bool Stream::CustomWrite(const IOBuffer& buffer, size_t offset) const {
+bool Stream::CustomWrite(const IOBuffer& buffer, size_t offset) {
     if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Write");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
         return false;
     }
-    bool state = wcore_custom_write(
-        fd_, buffer.GetDataPtr(), offset, buffer.GetBufferSize());
+    bool state = CoreCustomWrite(
+        buffer.GetDataPtr(), offset, buffer.GetBufferSize());
     return state;
 }
 
-bool Stream::CustomWrite(const str& buffer, size_t offset) const {
+bool Stream::CustomWrite(const str& buffer, size_t offset) {
     if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Write");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
         return false;
     }
-    bool state = wcore_custom_write(
-        fd_, reinterpret_cast<const uint8_t*>(buffer.data()), offset, buffer.size());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    bool state = CoreCustomWrite(
+        reinterpret_cast<const uint8_t*>(buffer.data()), offset, buffer.size());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
     return state;
 }
 
+
+bool Stream::CustomWrite(std::span<const uint8_t> buffer, size_t offset) {
+    if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
+        return false;
+    }
+    bool state = CoreCustomWrite(
+        buffer.data(), offset, buffer.size());
+    return state;
+}
+
+
+bool Stream::CustomWrite(std::span<const std::byte> buffer, size_t offset) {
+    return CustomWrite(std::span<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()), offset);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
 } // namespace wiseio
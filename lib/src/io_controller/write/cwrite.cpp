@@ -1,4 +1,6 @@
-#include <cstdint>  // Copyright 2025 wiserin
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -15,37 +17,51 @@ namespace wiseio {
 
 bool Stream::CWrite(const std::vector<uint8_t>& buffer) {
     if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Write");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
         return false;
     }
-    bool state = wcore_cwrite(
-        fd_, buffer.data(), buffer.size(),
-        &cursor_);
+    bool state = CoreCWrite(
+        buffer.data(), buffer.size());
     return state;
 }
 
 
 bool Stream::CWrite(const IOBuffer& buffer) {
     if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Write");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
         return false;
     }
-    bool state = wcore_cwrite(
-        fd_, buffer.GetDataPtr(), buffer.GetBufferSize(),
-        &cursor_);
+    bool state = CoreCWrite(
+        buffer.GetDataPtr(), buffer.GetBufferSize());
     return state;
 }
 
 bool Stream::CWrite(const str& buffer) {
     if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
-        logger_.Exception("Для использования этого метода файл должен быть открыт в режиме Write");
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
         return false;
     }
-    bool state = wcore_cwrite(
-        fd_, reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size(),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-        &cursor_);
+    bool state = CoreCWrite(
+        reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
     return state;
 }
 
 
+bool Stream::CWrite(std::span<const uint8_t> buffer) {
+    if (mode_ != OpenMode::kWrite && mode_ != OpenMode::kReadAndWrite) {
+        ReportError(StreamError::kWrongMode, "Для использования этого метода файл должен быть открыт в режиме Write");
+        return false;
+    }
+    bool state = CoreCWrite(
+        buffer.data(), buffer.size());
+    return state;
+}
+
+
+bool Stream::CWrite(std::span<const std::byte> buffer) {
+    return CWrite(std::span<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+
 } // namespace wiseio
@@ -0,0 +1,47 @@
+#include <cstddef>  // Copyright 2025 wiserin
+#include <cstdint>
+#include <expected>
+#include <span>
+
+#include "wise-io/schemas.hpp"
+#include "wise-io/stream.hpp"
+
+
+namespace wiseio {
+
+IOResult Stream::TryCWrite(std::span<const uint8_t> buffer) {
+    if (!IsOpen()) {
+        return std::unexpected(make_error_code(StreamError::kClosed));
+    }
+    ClearError();
+    if (!CWrite(buffer)) {
+        return std::unexpected(GetErrorCode());
+    }
+    return buffer.size();
+}
+
+
+IOResult Stream::TryAWrite(std::span<const uint8_t> buffer) {
+    if (!IsOpen()) {
+        return std::unexpected(make_error_code(StreamError::kClosed));
+    }
+    ClearError();
+    if (!AWrite(buffer)) {
+        return std::unexpected(GetErrorCode());
+    }
+    return buffer.size();
+}
+
+
+IOResult Stream::TryCustomWrite(std::span<const uint8_t> buffer, size_t offset) {
+    if (!IsOpen()) {
+        return std::unexpected(make_error_code(StreamError::kClosed));
+    }
+    ClearError();
+    if (!CustomWrite(buffer, offset)) {
+        return std::unexpected(GetErrorCode());
+    }
+    return buffer.size();
+}
+
+} // namespace wiseio
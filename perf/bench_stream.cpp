@@ -4,10 +4,12 @@
 //
 // Сценарии:
 //   1. CRead (буферизованное sequential чтение чанками)
-//   2. ReadAll (весь файл за один вызов)
+//   2. ReadAll (весь файл за один вызов, в том числе параллельно)
 //   3. CustomRead (pread по offset без seek)
 //   4. CWrite (буферизованная запись чанками)
 //   5. Открытие/закрытие файла (overhead на создание Stream)
+//   6. Запись мелкими записями через BufferedWriter
+//   7. Повторное открытие через StreamPool
 // NOLINTBEGIN
 #include <algorithm>
 #include <chrono>
@@ -25,8 +27,10 @@
 #include <logging/schemas.hpp>
 
 #include "wise-io/byte/storage.hpp"
+#include "wise-io/pool.hpp"
 #include "wise-io/schemas.hpp"
 #include "wise-io/stream.hpp"
+#include "wise-io/writer.hpp"
 
 namespace fs = std::filesystem;
 using Clock = std::chrono::high_resolution_clock;
@@ -154,7 +158,7 @@ static void PrintTableHeader() {
 }
 
 static void PrintRow(const Row& r, double baseline_mbps) {
-    bool is_stream = (r.impl == "Stream");
+    bool is_stream = r.impl.starts_with("Stream");
     double ratio   = r.mbps / baseline_mbps;
 
     std::cout << "  │  ";
@@ -242,6 +246,19 @@ static std::pair<Row, Row> BenchReadAll(
     };
 }
 
+static Row BenchReadAllParallel(
+        const std::string& path, size_t file_sz,
+        int warmup, int iters) {
+
+    double st_ms = Measure(warmup, iters, [&]() {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+        std::vector<uint8_t> buf;
+        stream.ReadAll(buf, wiseio::ParallelReadOptions {});
+    });
+
+    return {"ReadAll", "Stream x4", st_ms, MBps(file_sz, st_ms), file_sz};
+}
+
 static std::pair<Row, Row> BenchCustomRead(
         const std::string& path, size_t file_sz, int n_reads, size_t read_sz,
         int warmup, int iters) {
@@ -307,6 +324,38 @@ static std::pair<Row, Row> BenchCWrite(
     };
 }
 
+static std::pair<Row, Row> BenchBufferedWrite(
+        const fs::path& tmp_dir, size_t total_sz, size_t record_sz,
+        int warmup, int iters) {
+
+    std::vector<uint8_t> payload(record_sz, 0xCD);
+    int n_records = static_cast<int>(total_sz / record_sz);
+
+    auto fs_path = (tmp_dir / "buffered_fs.bin").string();
+    auto st_path = (tmp_dir / "buffered_st.bin").string();
+
+    double fs_ms = Measure(warmup, iters, [&]() {
+        std::ofstream f(fs_path, std::ios::binary | std::ios::trunc);
+        for (int i = 0; i < n_records; ++i) {
+            f.write(reinterpret_cast<char*>(payload.data()),
+                    static_cast<std::streamsize>(record_sz));
+        }
+    });
+
+    double st_ms = Measure(warmup, iters, [&]() {
+        auto stream = wiseio::CreateStream(st_path.c_str(), wiseio::OpenMode::kWrite);
+        wiseio::BufferedWriter writer(stream);
+        for (int i = 0; i < n_records; ++i) {
+            writer.Write(payload);
+        }
+    });
+
+    return {
+        {"BufferedWriter", "fstream", fs_ms, MBps(total_sz, fs_ms), total_sz},
+        {"BufferedWriter", "Stream",  st_ms, MBps(total_sz, st_ms), total_sz}
+    };
+}
+
 static std::pair<Row, Row> BenchOpenClose(
         const std::string& path, int n_opens,
         int warmup, int iters) {
@@ -336,6 +385,24 @@ static std::pair<Row, Row> BenchOpenClose(
     };
 }
 
+static Row BenchPoolAcquire(
+        const std::string& path, int n_opens,
+        int warmup, int iters) {
+
+    size_t fake_bytes = static_cast<size_t>(n_opens) * 1;
+    wiseio::StreamPool pool;
+    fs::path file = path;
+
+    double pool_ms = Measure(warmup, iters, [&]() {
+        for (int i = 0; i < n_opens; ++i) {
+            auto lease = pool.Acquire(file, wiseio::OpenMode::kRead);
+            (void)lease->IsOpen();
+        }
+    });
+
+    return {"Open/Close", "Pool", pool_ms, (pool_ms * 1000.0) / n_opens, fake_bytes};
+}
+
 // =====================================================================
 // main
 // =====================================================================
@@ -364,6 +431,7 @@ int main() {
     constexpr int    RAND_READS  = 500;
     constexpr size_t RAND_SZ     = 4096;
     constexpr int    OPENS       = 500;
+    constexpr size_t RECORD_SZ   = 64;
 
     PrintHeader();
 
@@ -376,6 +444,8 @@ int main() {
               << (CHUNK_64K / 1024) << " KB / "
               << (CHUNK_1M / 1024 / 1024) << " MB\n";
     std::cout << "    CWrite total         : " << (FILE_32MB / 1024 / 1024) << " MB\n";
+    std::cout << "    BufferedWriter       : " << (FILE_32MB / 1024 / 1024) << " MB записями по "
+              << RECORD_SZ << " B\n";
     std::cout << "    Open/Close           : " << OPENS << " ops\n";
     std::cout << "    Iterations           : " << WARMUP << " warmup + "
               << ITERS << " measured (median)\n\n";
@@ -391,9 +461,11 @@ int main() {
     {
         PrintSectionHeader("1. ReadAll  —  весь файл за один вызов");
         auto [fs_r, st_r] = BenchReadAll(big_file, FILE_256MB, WARMUP, ITERS);
+        auto par_r = BenchReadAllParallel(big_file, FILE_256MB, WARMUP, ITERS);
         PrintTableHeader();
         PrintRow(fs_r, fs_r.mbps);
         PrintRow(st_r, fs_r.mbps);
+        PrintRow(par_r, fs_r.mbps);
         PrintSectionFooter();
         PrintSummary("ReadAll", st_r.mbps, fs_r.mbps);
         summaries.push_back({"ReadAll", st_r.mbps, fs_r.mbps});
@@ -461,8 +533,21 @@ int main() {
     }
 
     {
-        PrintSectionHeader("7. Open / Close  —  overhead создания Stream (µs/op)");
+        PrintSectionHeader("7. BufferedWriter  —  запись мелкими записями по 64 B");
+        auto [fs_r, st_r] = BenchBufferedWrite(tmp, FILE_32MB, RECORD_SZ, WARMUP, ITERS);
+        PrintTableHeader();
+        PrintRow(fs_r, fs_r.mbps);
+        PrintRow(st_r, fs_r.mbps);
+        PrintSectionFooter();
+        PrintSummary("BufferedWriter", st_r.mbps, fs_r.mbps);
+        summaries.push_back({"BufferedWriter", st_r.mbps, fs_r.mbps});
+        std::cout << "\n";
+    }
+
+    {
+        PrintSectionHeader("8. Open / Close  —  overhead создания Stream (µs/op)");
         auto [fs_r, st_r] = BenchOpenClose(rand_file, OPENS, WARMUP, ITERS);
+        auto pool_r = BenchPoolAcquire(rand_file, OPENS, WARMUP, ITERS);
 
         std::cout << BOLD
                   << "  │  " << std::left
@@ -491,6 +576,17 @@ int main() {
                   << Bar(ratio) << " " << std::fixed << std::setprecision(2) << ratio << "x"
                   << RESET << "\n";
 
+        double pool_ratio = fs_r.mbps / pool_r.mbps;
+        bool pool_better  = pool_r.mbps <= fs_r.mbps;
+        std::cout << "  │  " << CYAN << BOLD << std::left << std::setw(12) << "Pool" << RESET
+                  << DIM << std::setw(12) << std::fixed << std::setprecision(3) << pool_r.ms << RESET
+                  << (pool_better ? GREEN : RED) << BOLD
+                  << std::setw(12) << std::fixed << std::setprecision(2) << pool_r.mbps << RESET
+                  << DIM << std::setw(10) << OPENS << RESET
+                  << (pool_better ? GREEN : RED)
+                  << Bar(pool_ratio) << " " << std::fixed << std::setprecision(2) << pool_ratio << "x"
+                  << RESET << "\n";
+
         PrintSectionFooter();
         bool stream_faster = st_r.mbps <= fs_r.mbps;
         double lat_ratio   = stream_faster ? (fs_r.mbps / st_r.mbps) : (st_r.mbps / fs_r.mbps);
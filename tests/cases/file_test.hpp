@@ -0,0 +1,59 @@
+// NOLINTBEGIN
+#pragma once
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <logging/logger.hpp>
+#include <logging/schemas.hpp>
+
+
+// Основа фикстур, работающих с файлами: свой временный каталог на набор тестов
+// и помощники для тестовых данных. Base - ::testing::Test или ::testing::TestWithParam<T>
+template<typename Base = ::testing::Test>
+class FileTest : public Base {
+protected:
+    explicit FileTest(const char* dir_name)
+        : test_dir_(std::filesystem::temp_directory_path() / dir_name) {}
+
+    void SetUp() override {
+        std::filesystem::create_directories(test_dir_);
+        logging::Logger::SetupLogger(logging::LoggerMode::kDebug, logging::LoggerIOMode::kSync, true);
+    }
+
+    void TearDown() override {
+        if (std::filesystem::exists(test_dir_)) {
+            std::filesystem::remove_all(test_dir_);
+        }
+    }
+
+    std::string CreateBinaryFile(const std::string& name, const std::vector<uint8_t>& data) {
+        auto path = test_dir_ / name;
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+        file.close();
+        return path.string();
+    }
+
+    static std::vector<uint8_t> ReadFileBinary(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    // Неповторяющиеся соседние байты: сдвиг или потеря блока видны при сравнении
+    static std::vector<uint8_t> MakePattern(size_t size) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+        return data;
+    }
+
+    std::filesystem::path test_dir_;
+};
+// NOLINTEND
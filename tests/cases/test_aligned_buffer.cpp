@@ -0,0 +1,146 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+#include "wise-io/buffer.hpp"
+#include "wise-io/stream.hpp"
+
+#include "file_test.hpp"
+
+namespace fs = std::filesystem;
+
+class AlignedBufferTest : public FileTest<> {
+protected:
+    AlignedBufferTest() : FileTest("wiseio_aligned_tests") {}
+};
+
+// ==================== Выделение памяти ====================
+
+TEST_F(AlignedBufferTest, ResizeBuffer_AlignedAndRounded) {
+    wiseio::AlignedIOBuffer buffer;
+    buffer.ResizeBuffer(5000);
+
+    EXPECT_EQ(buffer.GetBufferSize(), 5000);
+    EXPECT_EQ(buffer.GetCapacity(), 8192);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.GetDataPtr()) % 4096, 0);
+}
+
+TEST_F(AlignedBufferTest, ResizeBuffer_KeepsDataOnGrow) {
+    wiseio::AlignedIOBuffer buffer(512);
+    buffer.ResizeBuffer(3);
+    buffer.GetDataPtr()[0] = 'a';
+    buffer.GetDataPtr()[1] = 'b';
+    buffer.GetDataPtr()[2] = 'c';
+
+    buffer.ResizeBuffer(2000);
+    EXPECT_EQ(buffer.GetCapacity(), 2048);
+    EXPECT_EQ(buffer.GetDataPtr()[2], 'c');
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.GetDataPtr()) % 512, 0);
+}
+
+TEST_F(AlignedBufferTest, ResizeBuffer_ShrinkKeepsCapacity) {
+    wiseio::AlignedIOBuffer buffer;
+    buffer.ResizeBuffer(10000);
+    const uint8_t* ptr = buffer.GetDataPtr();
+
+    buffer.ResizeBuffer(10);
+    EXPECT_EQ(buffer.GetBufferSize(), 10);
+    EXPECT_EQ(buffer.GetDataPtr(), ptr);
+}
+
+TEST_F(AlignedBufferTest, Constructor_InvalidAlignment_Throws) {
+    EXPECT_THROW(wiseio::AlignedIOBuffer(3000), std::invalid_argument);
+}
+
+TEST_F(AlignedBufferTest, MoveConstructor_TransfersOwnership) {
+    wiseio::AlignedIOBuffer buffer;
+    buffer.ResizeBuffer(100);
+    uint8_t* ptr = buffer.GetDataPtr();
+
+    wiseio::AlignedIOBuffer moved(std::move(buffer));
+    EXPECT_EQ(moved.GetDataPtr(), ptr);
+    EXPECT_EQ(moved.GetBufferSize(), 100);
+    EXPECT_EQ(buffer.GetDataPtr(), nullptr);
+}
+
+// ==================== O_DIRECT ====================
+
+TEST_F(AlignedBufferTest, DirectRead_UnalignedTail) {
+    auto data = MakePattern(3 * 4096 + 123);
+    auto path = CreateBinaryFile("direct_read.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, wiseio::IOBackend::kDirect);
+
+    wiseio::AlignedIOBuffer buffer;
+    buffer.ResizeBuffer(data.size() + 1000);
+    ssize_t len = stream.CRead(buffer);
+
+    EXPECT_EQ(len, static_cast<ssize_t>(data.size()));
+    EXPECT_TRUE(stream.IsEOF());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), buffer.GetDataPtr()));
+}
+
+TEST_F(AlignedBufferTest, DirectRead_UnalignedOffsetAndBuffer) {
+    auto data = MakePattern(20000);
+    auto path = CreateBinaryFile("direct_offset.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, wiseio::IOBackend::kDirect);
+
+    std::vector<uint8_t> buffer(5003);
+    EXPECT_EQ(stream.CustomRead(buffer, 777), 5003);
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin() + 777));
+}
+
+TEST_F(AlignedBufferTest, DirectWrite_AlignedAndTail) {
+    auto path = (test_dir_ / "direct_write.bin").string();
+    auto data = MakePattern(2 * 4096 + 50);
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite, false, wiseio::IOBackend::kDirect);
+        wiseio::AlignedIOBuffer buffer;
+        buffer.ResizeBuffer(data.size());
+        std::copy(data.begin(), data.end(), buffer.GetDataPtr());
+
+        EXPECT_TRUE(stream.CWrite(buffer));
+        EXPECT_EQ(stream.GetCursor(), data.size());
+        EXPECT_TRUE(stream.CWrite(std::string("xyz")));
+    }
+    auto result = ReadFileBinary(path);
+    ASSERT_EQ(result.size(), data.size() + 3);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), result.begin()));
+    EXPECT_EQ(result.back(), 'z');
+}
+
+TEST_F(AlignedBufferTest, DirectWrite_UnalignedOffset_KeepsNeighbours) {
+    auto data = MakePattern(3 * 4096 + 100);
+    auto path = CreateBinaryFile("direct_rmw.bin", data);
+    std::vector<uint8_t> patch(5000, 0xEE);
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite, false, wiseio::IOBackend::kDirect);
+        EXPECT_TRUE(stream.CustomWrite(patch, 1000));
+    }
+    std::copy(patch.begin(), patch.end(), data.begin() + 1000);
+    EXPECT_EQ(ReadFileBinary(path), data);
+}
+
+TEST_F(AlignedBufferTest, DirectWrite_UnalignedPastEnd_ExactSize) {
+    auto data = MakePattern(4096 + 10);
+    auto path = CreateBinaryFile("direct_extend.bin", data);
+    std::vector<uint8_t> patch(100, 0x42);
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite, false, wiseio::IOBackend::kDirect);
+        EXPECT_TRUE(stream.CustomWrite(patch, data.size() - 20));
+        EXPECT_EQ(stream.GetFileSize(), data.size() + 80);
+    }
+    data.resize(data.size() - 20);
+    data.insert(data.end(), patch.begin(), patch.end());
+    EXPECT_EQ(ReadFileBinary(path), data);
+}
+
+TEST_F(AlignedBufferTest, DirectAppend_FallsBackToSync) {
+    auto path = (test_dir_ / "direct_append.bin").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend, false, wiseio::IOBackend::kDirect);
+
+    EXPECT_EQ(stream.GetBackend(), wiseio::IOBackend::kSync);
+    EXPECT_TRUE(stream.AWrite(std::string("abc")));
+}
+// NOLINTEND
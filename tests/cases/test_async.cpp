@@ -0,0 +1,346 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <coroutine>
+#include <exception>
+#include <filesystem>
+#include <latch>
+#include <memory>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "wise-io/async.hpp"
+#include "wise-io/buffer.hpp"
+#include "wise-io/stream.hpp"
+#include "wise-io/schemas.hpp"
+
+#include "file_test.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Корутина без результата: стартует сразу, кадр освобождается в конце
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+template<typename Make>
+Detached Await(Make make, wiseio::IOResult& result, std::latch& done) {
+    result = co_await make();
+    done.count_down();
+}
+
+// Дожидается одной операции из обычного потока теста
+template<typename Make>
+wiseio::IOResult Wait(Make make) {
+    wiseio::IOResult result;
+    std::latch done(1);
+    Await(make, result, done);
+    done.wait();
+    return result;
+}
+
+} // namespace
+
+class AsyncTest : public FileTest<::testing::TestWithParam<wiseio::IOBackend>> {
+protected:
+    AsyncTest() : FileTest("wiseio_async_tests") {}
+
+    void SetUp() override {
+        FileTest::SetUp();
+        reactor_ = wiseio::CreateReactor(GetParam());
+    }
+
+    void TearDown() override {
+        reactor_.reset();
+        FileTest::TearDown();
+    }
+
+    std::unique_ptr<wiseio::Reactor> reactor_;
+};
+
+// ==================== Чтение ====================
+
+TEST_P(AsyncTest, AsyncRead_Offset) {
+    auto data = MakePattern(1000);
+    auto path = CreateBinaryFile("read.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    std::vector<uint8_t> buffer(100);
+    auto result = Wait([&]() { return stream.AsyncRead(buffer, 500, reactor_.get()); });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 100);
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin() + 500));
+    EXPECT_EQ(stream.GetCursor(), 0);
+}
+
+TEST_P(AsyncTest, AsyncRead_PastEOF_ShortResult) {
+    auto data = MakePattern(100);
+    auto path = CreateBinaryFile("short.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    std::vector<uint8_t> buffer(64);
+    auto result = Wait([&]() { return stream.AsyncRead(buffer, 80, reactor_.get()); });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 20);
+    EXPECT_FALSE(stream.IsEOF());
+}
+
+TEST_P(AsyncTest, AsyncReadAll_Vector) {
+    auto data = MakePattern(5000);
+    auto path = CreateBinaryFile("all.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    std::vector<uint8_t> buffer;
+    auto result = Wait([&]() { return stream.AsyncReadAll(buffer, reactor_.get()); });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 5000);
+    EXPECT_EQ(buffer, data);
+}
+
+// Старое содержимое заменяется файлом
+TEST_P(AsyncTest, AsyncReadAll_ByteBuffer) {
+    auto data = MakePattern(5000);
+    auto path = CreateBinaryFile("all_bytes.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    wiseio::ByteBuffer buffer {1, 2, 3};
+    auto result = Wait([&]() { return stream.AsyncReadAll(buffer, reactor_.get()); });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 5000);
+    EXPECT_EQ(buffer, data);
+}
+
+TEST_P(AsyncTest, AsyncReadAll_String) {
+    std::vector<uint8_t> data {'h', 'e', 'l', 'l', 'o'};
+    auto path = CreateBinaryFile("all.txt", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    std::string buffer;
+    auto result = Wait([&]() { return stream.AsyncReadAll(buffer, reactor_.get()); });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(buffer, "hello");
+}
+
+TEST_P(AsyncTest, AsyncRead_Direct) {
+    auto data = MakePattern(3 * 4096 + 100);
+    auto path = CreateBinaryFile("direct.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, wiseio::IOBackend::kDirect);
+
+    wiseio::AlignedIOBuffer aligned;
+    aligned.ResizeBuffer(2 * 4096);
+    auto result = Wait([&]() {
+        return stream.AsyncRead({aligned.GetDataPtr(), aligned.GetBufferSize()}, 4096, reactor_.get());
+    });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 2 * 4096);
+    EXPECT_TRUE(std::equal(aligned.GetDataPtr(), aligned.GetDataPtr() + 2 * 4096, data.begin() + 4096));
+
+    std::vector<uint8_t> unaligned(300);
+    auto tail = Wait([&]() { return stream.AsyncRead(unaligned, 3 * 4096 - 50, reactor_.get()); });
+    ASSERT_TRUE(tail.has_value());
+    EXPECT_EQ(*tail, 150);
+    EXPECT_TRUE(std::equal(unaligned.begin(), unaligned.begin() + 150, data.begin() + 3 * 4096 - 50));
+}
+
+TEST_P(AsyncTest, AsyncRead_Mmap_CompletesInline) {
+    auto data = MakePattern(256);
+    auto path = CreateBinaryFile("mmap.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, wiseio::IOBackend::kMmap);
+
+    std::vector<uint8_t> buffer(64);
+    auto io = stream.AsyncRead(buffer, 10, reactor_.get());
+    if (stream.GetBackend() == wiseio::IOBackend::kMmap) {
+        EXPECT_TRUE(io.await_ready());
+    }
+    auto result = Wait([&]() { return stream.AsyncRead(buffer, 10, reactor_.get()); });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin() + 10));
+}
+
+// ==================== Запись ====================
+
+TEST_P(AsyncTest, AsyncWrite_TracksSize) {
+    auto path = (test_dir_ / "write.bin").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+    auto data = MakePattern(4000);
+
+    auto result = Wait([&]() {
+        return stream.AsyncWrite(std::span<const uint8_t>(data), 100, reactor_.get());
+    });
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 4000);
+    EXPECT_EQ(stream.GetFileSize(), 4100);
+    stream.Close();
+
+    auto file = ReadFileBinary(path);
+    ASSERT_EQ(file.size(), 4100);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), file.begin() + 100));
+}
+
+TEST_P(AsyncTest, AsyncAWrite_Appends) {
+    auto path = CreateBinaryFile("append.txt", {'a', 'b'});
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+    std::vector<uint8_t> first {'c', 'd'};
+    std::vector<uint8_t> second {'e'};
+
+    EXPECT_TRUE(Wait([&]() { return stream.AsyncAWrite(std::span<const uint8_t>(first), reactor_.get()); }));
+    EXPECT_TRUE(Wait([&]() { return stream.AsyncAWrite(std::span<const uint8_t>(second), reactor_.get()); }));
+    EXPECT_EQ(stream.GetFileSize(), 5);
+    stream.Close();
+
+    auto file = ReadFileBinary(path);
+    EXPECT_EQ(std::string(file.begin(), file.end()), "abcde");
+}
+
+TEST_P(AsyncTest, AsyncWrite_Direct_Unaligned) {
+    auto path = (test_dir_ / "direct_write.bin").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite, false, wiseio::IOBackend::kDirect);
+    auto data = MakePattern(5000);
+
+    auto result = Wait([&]() {
+        return stream.AsyncWrite(std::span<const uint8_t>(data), 0, reactor_.get());
+    });
+    ASSERT_TRUE(result.has_value());
+    stream.Close();
+    EXPECT_EQ(ReadFileBinary(path), data);
+}
+
+// ==================== Ошибки ====================
+
+TEST_P(AsyncTest, WrongMode_CompletesInline) {
+    auto path = CreateBinaryFile("mode.bin", {1, 2, 3});
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    std::vector<uint8_t> data {1};
+
+    auto io = stream.AsyncWrite(std::span<const uint8_t>(data), 0, reactor_.get());
+    EXPECT_TRUE(io.await_ready());
+    EXPECT_EQ(io.await_resume().error(), wiseio::StreamError::kWrongMode);
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kWrongMode);
+
+    auto append = Wait([&]() { return stream.AsyncAWrite(std::span<const uint8_t>(data), reactor_.get()); });
+    EXPECT_EQ(append.error(), wiseio::StreamError::kWrongMode);
+}
+
+TEST_P(AsyncTest, Closed_CompletesInline) {
+    auto path = CreateBinaryFile("closed.bin", {1, 2, 3});
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    stream.Close();
+
+    std::vector<uint8_t> buffer(3);
+    auto result = Wait([&]() { return stream.AsyncRead(buffer, 0, reactor_.get()); });
+    EXPECT_EQ(result.error(), wiseio::StreamError::kClosed);
+}
+
+TEST_P(AsyncTest, WriteError_CarriesErrno) {
+    auto stream = wiseio::CreateStream("/dev/full", wiseio::OpenMode::kWrite);
+    std::vector<uint8_t> data(64, 1);
+
+    auto result = Wait([&]() {
+        return stream.AsyncWrite(std::span<const uint8_t>(data), 0, reactor_.get());
+    });
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), std::errc::no_space_on_device);
+    // Корутина продолжилась в потоке реактора: ошибка только в результате, стрим не тронут
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kNone);
+}
+
+// ==================== Параллельные операции ====================
+
+// Больше операций, чем мест в кольце: часть ждет в очереди реактора
+TEST_P(AsyncTest, ManyInFlight) {
+    constexpr size_t kCount = 600;
+    constexpr size_t kBlock = 512;
+    auto data = MakePattern(kCount * kBlock);
+    auto path = CreateBinaryFile("many.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    std::vector<std::vector<uint8_t>> buffers(kCount, std::vector<uint8_t>(kBlock));
+    std::vector<wiseio::IOResult> results(kCount);
+    std::latch done(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        Await([&, i]() { return stream.AsyncRead(buffers[i], i * kBlock, reactor_.get()); }, results[i], done);
+    }
+    done.wait();
+
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_TRUE(results[i].has_value());
+        EXPECT_EQ(*results[i], kBlock);
+        EXPECT_TRUE(std::equal(buffers[i].begin(), buffers[i].end(), data.begin() + i * kBlock));
+    }
+}
+
+// Размер файла учитывается в потоках реактора, параллельные завершения не теряют записи
+TEST_P(AsyncTest, ManyAppends_FileSizeCounted) {
+    constexpr size_t kCount = 300;
+    constexpr size_t kBlock = 64;
+    auto path = CreateBinaryFile("appends.bin", {});
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+    auto data = MakePattern(kBlock);
+
+    std::vector<wiseio::IOResult> results(kCount);
+    std::latch done(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        Await([&]() { return stream.AsyncAWrite(std::span<const uint8_t>(data), reactor_.get()); }, results[i], done);
+    }
+    done.wait();
+
+    for (const auto& result : results) {
+        ASSERT_TRUE(result.has_value());
+    }
+    EXPECT_EQ(stream.GetFileSize(), kCount * kBlock);
+    stream.Close();
+    EXPECT_EQ(ReadFileBinary(path).size(), kCount * kBlock);
+}
+
+TEST_P(AsyncTest, ManyWrites_WriteBehind_FileSizeIsMax) {
+    constexpr size_t kCount = 64;
+    constexpr size_t kBlock = 256 * 1024;  // вместе 16 MiB - два окна write-behind
+    auto path = (test_dir_ / "write_behind.bin").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+    stream.SetDurability(wiseio::Durability::kWriteBehind);
+    auto data = MakePattern(kBlock);
+
+    std::vector<wiseio::IOResult> results(kCount);
+    std::latch done(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        Await([&, i]() { return stream.AsyncWrite(std::span<const uint8_t>(data), i * kBlock, reactor_.get()); },
+            results[i], done);
+    }
+    done.wait();
+
+    for (const auto& result : results) {
+        ASSERT_TRUE(result.has_value());
+    }
+    EXPECT_EQ(stream.GetFileSize(), kCount * kBlock);
+    stream.Close();
+    EXPECT_EQ(ReadFileBinary(path).size(), kCount * kBlock);
+}
+
+TEST_P(AsyncTest, DefaultReactor) {
+    auto data = MakePattern(64);
+    auto path = CreateBinaryFile("default.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    wiseio::Reactor::SetDefault(reactor_.get());
+    EXPECT_EQ(&wiseio::Reactor::GetDefault(), reactor_.get());
+
+    std::vector<uint8_t> buffer(64);
+    auto result = Wait([&]() { return stream.AsyncRead(buffer, 0); });
+    wiseio::Reactor::SetDefault(nullptr);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(buffer, data);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Reactors, AsyncTest,
+    ::testing::Values(wiseio::IOBackend::kSync, wiseio::IOBackend::kIOUring));
+// NOLINTEND
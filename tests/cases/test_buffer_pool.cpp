@@ -0,0 +1,154 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "wise-io/buffer.hpp"
+#include "wise-io/buffer_pool.hpp"
+
+class BufferPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        wiseio::BufferPool::Trim();
+    }
+
+    void TearDown() override {
+        wiseio::BufferPool::Trim();
+    }
+};
+
+// ==================== Acquire / Release ====================
+
+TEST_F(BufferPoolTest, Acquire_RoundsUpToClass) {
+    auto buffer = wiseio::BufferPool::Acquire(1000);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.capacity(), 1024);
+
+    auto small = wiseio::BufferPool::Acquire(1);
+    EXPECT_EQ(small.capacity(), 256);
+}
+
+TEST_F(BufferPoolTest, Release_ReusedOnSameThread) {
+    auto buffer = wiseio::BufferPool::Acquire(4096);
+    buffer.resize(100, 7);
+    const uint8_t* data = buffer.data();
+    wiseio::BufferPool::Release(std::move(buffer));
+
+    size_t allocations = wiseio::BufferPool::GetCounters().allocations;
+    auto reused = wiseio::BufferPool::Acquire(3000);
+    EXPECT_EQ(reused.data(), data);
+    EXPECT_TRUE(reused.empty());
+    EXPECT_EQ(wiseio::BufferPool::GetCounters().allocations, allocations);
+}
+
+TEST_F(BufferPoolTest, Release_SmallerClassNotReturnedForLarger) {
+    auto buffer = wiseio::BufferPool::Acquire(1024);
+    const uint8_t* data = buffer.data();
+    wiseio::BufferPool::Release(std::move(buffer));
+
+    auto larger = wiseio::BufferPool::Acquire(1025);
+    EXPECT_NE(larger.data(), data);
+    EXPECT_GE(larger.capacity(), 1025);
+}
+
+TEST_F(BufferPoolTest, Oversize_NotPooled) {
+    size_t size = (size_t{1} << wiseio::BufferPool::kMaxClassShift) + 1;
+    auto buffer = wiseio::BufferPool::Acquire(size);
+    EXPECT_GE(buffer.capacity(), size);
+    wiseio::BufferPool::Release(std::move(buffer));
+
+    size_t allocations = wiseio::BufferPool::GetCounters().allocations;
+    auto another = wiseio::BufferPool::Acquire(size);
+    EXPECT_EQ(wiseio::BufferPool::GetCounters().allocations, allocations + 1);
+}
+
+TEST_F(BufferPoolTest, CrossThread_ReleaseGoesToShared) {
+    std::thread([]() {
+        wiseio::BufferPool::Release(wiseio::BufferPool::Acquire(8192));
+    }).join();
+    // кэш завершившегося потока отдан в общий запас
+    size_t shared_hits = wiseio::BufferPool::GetCounters().shared_hits;
+    auto reused = wiseio::BufferPool::Acquire(8192);
+    EXPECT_EQ(reused.capacity(), 8192);
+    EXPECT_EQ(wiseio::BufferPool::GetCounters().shared_hits, shared_hits + 1);
+}
+
+// ==================== Бюджет ====================
+
+TEST_F(BufferPoolTest, ThreadCache_LimitedByBytes) {
+    constexpr size_t kSize = 1024 * 1024;
+    std::vector<std::vector<uint8_t>> buffers;
+    for (int i = 0; i < 6; ++i) {
+        buffers.push_back(wiseio::BufferPool::Acquire(kSize));
+    }
+    for (auto& buffer : buffers) {
+        wiseio::BufferPool::Release(std::move(buffer));
+    }
+    // в кэш потока помещаются 4 MiB, остальное уходит в общий запас
+    EXPECT_EQ(wiseio::BufferPool::GetCounters().shared_bytes, 6 * kSize - wiseio::BufferPool::kThreadCacheBytes);
+}
+
+TEST_F(BufferPoolTest, LargeClass_NotCachedPerThread) {
+    size_t size = 2 * wiseio::BufferPool::kThreadCacheBytes;
+    wiseio::BufferPool::Release(wiseio::BufferPool::Acquire(size));
+    EXPECT_EQ(wiseio::BufferPool::GetCounters().shared_bytes, size);
+}
+
+TEST_F(BufferPoolTest, Shared_LimitedByBytes) {
+    constexpr size_t kSize = 16 * 1024 * 1024;
+    size_t dropped = wiseio::BufferPool::GetCounters().dropped;
+    std::vector<std::vector<uint8_t>> buffers;
+    for (int i = 0; i < 6; ++i) {
+        buffers.push_back(wiseio::BufferPool::Acquire(kSize));
+    }
+    for (auto& buffer : buffers) {
+        wiseio::BufferPool::Release(std::move(buffer));
+    }
+    EXPECT_EQ(wiseio::BufferPool::GetCounters().shared_bytes, wiseio::BufferPool::kSharedBytes);
+    EXPECT_EQ(wiseio::BufferPool::GetCounters().dropped, dropped + 2);
+}
+
+// ==================== Reserve ====================
+
+TEST_F(BufferPoolTest, Reserve_KeepsContent) {
+    std::vector<uint8_t> buffer = {1, 2, 3, 4, 5};
+    wiseio::BufferPool::Reserve(buffer, 5000);
+    EXPECT_GE(buffer.capacity(), 5000);
+    EXPECT_EQ(buffer, (std::vector<uint8_t>{1, 2, 3, 4, 5}));
+}
+
+TEST_F(BufferPoolTest, Reserve_EnoughCapacity_NoChange) {
+    auto buffer = wiseio::BufferPool::Acquire(512);
+    const uint8_t* data = buffer.data();
+    wiseio::BufferPool::Reserve(buffer, 300);
+    EXPECT_EQ(buffer.data(), data);
+}
+
+// ==================== BytesIOBuffer ====================
+
+TEST_F(BufferPoolTest, BytesBuffer_ClearRecycles) {
+    wiseio::BytesIOBuffer first;
+    first.ResizeBuffer(10000);
+    const uint8_t* data = first.GetDataPtr();
+    first.Clear();
+    EXPECT_EQ(first.GetBufferSize(), 0);
+
+    wiseio::BytesIOBuffer second;
+    second.ResizeBuffer(9000);
+    EXPECT_EQ(second.GetDataPtr(), data);
+}
+
+TEST_F(BufferPoolTest, BytesBuffer_AddDataKeepsContent) {
+    wiseio::BytesIOBuffer buffer;
+    std::vector<uint8_t> part(300, 1);
+    std::vector<uint8_t> expected;
+    for (int i = 0; i < 20; ++i) {
+        std::fill(part.begin(), part.end(), static_cast<uint8_t>(i));
+        buffer.AddDataToBuffer(part);
+        expected.insert(expected.end(), part.begin(), part.end());
+    }
+    EXPECT_EQ(buffer.ReadFromBuffer(expected.size()), expected);
+}
+// NOLINTEND
@@ -0,0 +1,171 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "wise-io/reader.hpp"
+#include "wise-io/stream.hpp"
+
+#include "file_test.hpp"
+
+namespace fs = std::filesystem;
+
+class BufferedReaderTest : public FileTest<> {
+protected:
+    BufferedReaderTest() : FileTest("wiseio_reader_tests") {}
+};
+
+// ==================== Peek / Skip ====================
+
+TEST_F(BufferedReaderTest, Peek_DoesNotConsume) {
+    auto data = MakePattern(100);
+    auto path = CreateBinaryFile("peek.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream, 16);
+
+    auto first = reader.Peek(4);
+    ASSERT_EQ(first.size(), 4u);
+    EXPECT_TRUE(std::equal(first.begin(), first.end(), data.begin()));
+    EXPECT_EQ(reader.GetPosition(), 0u);
+
+    std::vector<uint8_t> buffer(4);
+    EXPECT_TRUE(reader.ReadExact(buffer));
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin()));
+    EXPECT_EQ(reader.GetPosition(), 4u);
+}
+
+TEST_F(BufferedReaderTest, Peek_LargerThanWindow) {
+    auto data = MakePattern(100);
+    auto path = CreateBinaryFile("peek_large.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream, 8);
+
+    auto view = reader.Peek(50);
+    ASSERT_EQ(view.size(), 50u);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin()));
+}
+
+TEST_F(BufferedReaderTest, Peek_PastEOF_Truncated) {
+    auto data = MakePattern(10);
+    auto path = CreateBinaryFile("peek_eof.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream);
+
+    reader.Skip(6);
+    EXPECT_EQ(reader.Peek(10).size(), 4u);
+}
+
+TEST_F(BufferedReaderTest, Skip_PastBufferedData) {
+    auto data = MakePattern(1000);
+    auto path = CreateBinaryFile("skip.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream, 32);
+
+    std::vector<uint8_t> buffer(2);
+    EXPECT_TRUE(reader.ReadExact(buffer));
+    reader.Skip(500);
+    EXPECT_TRUE(reader.ReadExact(buffer));
+    EXPECT_EQ(buffer[0], data[502]);
+    EXPECT_EQ(buffer[1], data[503]);
+}
+
+TEST_F(BufferedReaderTest, Skip_PastEnd_ThrowsAndKeepsPosition) {
+    auto data = MakePattern(10);
+    auto path = CreateBinaryFile("skip_end.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream);
+
+    reader.Skip(4);
+    EXPECT_THROW(reader.Skip(7), std::out_of_range);
+    EXPECT_EQ(reader.GetPosition(), 4u);
+    EXPECT_NO_THROW(reader.Skip(6));
+}
+
+// ==================== Read ====================
+
+TEST_F(BufferedReaderTest, Read_SmallReadsAcrossWindows) {
+    auto data = MakePattern(10000);
+    auto path = CreateBinaryFile("small_reads.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream, 64);
+
+    std::vector<uint8_t> result;
+    std::vector<uint8_t> buffer(3);
+    while (true) {
+        size_t len = reader.Read(buffer);
+        result.insert(result.end(), buffer.begin(), buffer.begin() + len);
+        if (len < buffer.size()) {
+            break;
+        }
+    }
+    EXPECT_EQ(result, data);
+}
+
+TEST_F(BufferedReaderTest, Read_LargerThanWindow_Direct) {
+    auto data = MakePattern(5000);
+    auto path = CreateBinaryFile("large_read.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream, 128);
+
+    std::vector<uint8_t> head(10);
+    EXPECT_TRUE(reader.ReadExact(head));
+    std::vector<uint8_t> rest(data.size() - 10);
+    EXPECT_TRUE(reader.ReadExact(rest));
+    EXPECT_TRUE(std::equal(rest.begin(), rest.end(), data.begin() + 10));
+}
+
+TEST_F(BufferedReaderTest, ReadExact_PastEOF_Fails) {
+    auto data = MakePattern(10);
+    auto path = CreateBinaryFile("exact_eof.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream);
+
+    std::vector<uint8_t> buffer(20);
+    EXPECT_FALSE(reader.ReadExact(buffer));
+}
+
+TEST_F(BufferedReaderTest, Read_ToEOF_StreamStillReadable) {
+    auto data = MakePattern(100);
+    auto path = CreateBinaryFile("no_eof_flag.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    {
+        wiseio::BufferedReader reader(stream);
+        std::vector<uint8_t> buffer(200);
+        EXPECT_EQ(reader.Read(buffer), 100u);
+    }
+
+    EXPECT_FALSE(stream.IsEOF());
+    std::vector<uint8_t> buffer(10);
+    EXPECT_EQ(stream.CustomRead(buffer, 50), 10);
+}
+
+// Окно еще не выделено: копирование нуля байт пропускается
+TEST_F(BufferedReaderTest, Read_EmptyBeforeFirstFill) {
+    auto path = CreateBinaryFile("empty_read.bin", MakePattern(100));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::BufferedReader reader(stream, 64);
+
+    EXPECT_EQ(reader.Read(std::span<uint8_t>()), 0u);
+    EXPECT_EQ(reader.GetPosition(), 0u);
+    std::vector<uint8_t> buffer(10);
+    EXPECT_EQ(reader.Read(buffer), 10u);
+}
+
+TEST_F(BufferedReaderTest, ZeroWindow_Unbuffered) {
+    auto data = MakePattern(100);
+    auto path = CreateBinaryFile("unbuffered.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    stream.SetCursor(20);
+    wiseio::BufferedReader reader(stream, 0);
+
+    EXPECT_EQ(reader.GetPosition(), 20u);
+    std::vector<uint8_t> buffer(5);
+    EXPECT_TRUE(reader.ReadExact(buffer));
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin() + 20));
+    EXPECT_EQ(stream.GetCursor(), 20u);
+}
+
+// NOLINTEND
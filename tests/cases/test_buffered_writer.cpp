@@ -0,0 +1,175 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+#include "wise-io/stream.hpp"
+#include "wise-io/writer.hpp"
+
+#include "file_test.hpp"
+
+namespace fs = std::filesystem;
+
+class BufferedWriterTest : public FileTest<> {
+protected:
+    BufferedWriterTest() : FileTest("wiseio_writer_tests") {}
+
+    // Пишет data записями по record байт
+    bool WriteRecords(wiseio::BufferedWriter& writer, const std::vector<uint8_t>& data, size_t record) {
+        for (size_t offset = 0; offset < data.size(); offset += record) {
+            size_t size = std::min(record, data.size() - offset);
+            if (!writer.Write(std::span<const uint8_t>(data.data() + offset, size))) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// ==================== Buffering ====================
+
+TEST_F(BufferedWriterTest, Capacity_RoundedToAlignment) {
+    auto path = test_dir_ / "capacity.bin";
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kWrite);
+    wiseio::BufferedWriter writer(stream, 100);
+
+    EXPECT_EQ(writer.GetCapacity(), wiseio::AlignedIOBuffer::kDefaultAlignment);
+}
+
+TEST_F(BufferedWriterTest, SmallWrites_StayInBuffer) {
+    auto path = test_dir_ / "small.bin";
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kWrite);
+    wiseio::BufferedWriter writer(stream, 4096);
+
+    EXPECT_TRUE(writer.Write(std::string("hello")));
+    EXPECT_TRUE(writer.Write(std::string(" world")));
+    EXPECT_EQ(writer.GetBuffered(), 11u);
+    EXPECT_EQ(fs::file_size(path), 0u);
+
+    EXPECT_TRUE(writer.Flush());
+    EXPECT_EQ(writer.GetBuffered(), 0u);
+    EXPECT_EQ(fs::file_size(path), 11u);
+}
+
+TEST_F(BufferedWriterTest, FullBuffer_Flushed) {
+    auto data = MakePattern(4096 + 10);
+    auto path = test_dir_ / "full.bin";
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kWrite);
+    wiseio::BufferedWriter writer(stream, 4096);
+
+    EXPECT_TRUE(WriteRecords(writer, data, 7));
+    EXPECT_EQ(fs::file_size(path), 4096u);
+    EXPECT_EQ(writer.GetBuffered(), 10u);
+}
+
+TEST_F(BufferedWriterTest, Destructor_Flushes) {
+    auto data = MakePattern(10000);
+    auto path = test_dir_ / "dtor.bin";
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kWrite);
+    {
+        wiseio::BufferedWriter writer(stream, 4096);
+        EXPECT_TRUE(WriteRecords(writer, data, 13));
+    }
+    stream.Close();
+
+    EXPECT_EQ(ReadFileBinary(path), data);
+}
+
+TEST_F(BufferedWriterTest, LargeWrite_BypassesBuffer) {
+    auto head = MakePattern(100);
+    auto large = MakePattern(3 * 4096);
+    auto path = test_dir_ / "large.bin";
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kWrite);
+    wiseio::BufferedWriter writer(stream, 4096);
+
+    EXPECT_TRUE(writer.Write(head));
+    EXPECT_TRUE(writer.Write(large));
+    EXPECT_EQ(writer.GetBuffered(), 0u);
+    stream.Close();
+
+    auto expected = head;
+    expected.insert(expected.end(), large.begin(), large.end());
+    EXPECT_EQ(ReadFileBinary(path), expected);
+}
+
+TEST_F(BufferedWriterTest, AppendMode_UsesAWrite) {
+    auto path = test_dir_ / "append.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "head:";
+    }
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kAppend);
+    {
+        wiseio::BufferedWriter writer(stream, 4096);
+        EXPECT_TRUE(writer.Write(std::string("tail")));
+    }
+    stream.Close();
+
+    auto content = ReadFileBinary(path);
+    EXPECT_EQ(std::string(content.begin(), content.end()), "head:tail");
+}
+
+TEST_F(BufferedWriterTest, ReadMode_Fails) {
+    auto path = test_dir_ / "read.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "data";
+    }
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kRead);
+    wiseio::BufferedWriter writer(stream, 4096);
+
+    EXPECT_TRUE(writer.Write(std::string("x")));
+    EXPECT_FALSE(writer.Flush());
+    EXPECT_FALSE(writer.Write(std::string("y")));
+}
+
+// ==================== Background flush ====================
+
+TEST_F(BufferedWriterTest, Async_PreservesOrder) {
+    auto data = MakePattern(100000);
+    auto path = test_dir_ / "async.bin";
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kWrite);
+    {
+        wiseio::BufferedWriter writer(stream, 4096, true);
+        EXPECT_TRUE(WriteRecords(writer, data, 33));
+        EXPECT_TRUE(writer.Write(MakePattern(20000)));
+        EXPECT_TRUE(WriteRecords(writer, data, 1000));
+    }
+    stream.Close();
+
+    auto expected = data;
+    auto middle = MakePattern(20000);
+    expected.insert(expected.end(), middle.begin(), middle.end());
+    expected.insert(expected.end(), data.begin(), data.end());
+    EXPECT_EQ(ReadFileBinary(path), expected);
+}
+
+TEST_F(BufferedWriterTest, Async_FlushWaitsForWorker) {
+    auto data = MakePattern(50000);
+    auto path = test_dir_ / "async_flush.bin";
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kWrite);
+    wiseio::BufferedWriter writer(stream, 8192, true);
+
+    EXPECT_TRUE(WriteRecords(writer, data, 17));
+    EXPECT_TRUE(writer.Flush());
+    EXPECT_EQ(fs::file_size(path), data.size());
+    EXPECT_EQ(ReadFileBinary(path), data);
+}
+
+TEST_F(BufferedWriterTest, Async_ErrorIsSticky) {
+    auto path = test_dir_ / "async_read.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "data";
+    }
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kRead);
+    wiseio::BufferedWriter writer(stream, 4096, true);
+
+    EXPECT_TRUE(writer.Write(std::string("x")));
+    EXPECT_FALSE(writer.Flush());
+    EXPECT_FALSE(writer.Write(std::string("y")));
+}
+// NOLINTEND
@@ -1,9 +1,13 @@
 // NOLINTBEGIN
 #include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <memory_resource>
 #include <stdexcept>
+#include <sys/stat.h>
 #include <vector>
 
 #include <logging/logger.hpp>
@@ -29,6 +33,29 @@ static void WriteU32LE(std::ofstream& f, uint32_t v) {
     f.write(reinterpret_cast<char*>(b), 4);
 }
 
+// Считает байты, которые еще не вернули ресурсу
+class CountingResource : public std::pmr::memory_resource {
+ public:
+    size_t outstanding = 0;
+    size_t allocations = 0;
+
+ private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        outstanding += bytes;
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        outstanding -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
 // ==================== Фикстура ====================
 
 class ByteFileTest : public ::testing::Test {
@@ -70,6 +97,12 @@ protected:
         return file;
     }
 
+    static ino_t GetInode(const std::string& path) {
+        struct stat file_stat {};
+        stat(path.c_str(), &file_stat);
+        return file_stat.st_ino;
+    }
+
     fs::path test_dir_;
     fs::path cache_dir_;
 };
@@ -115,6 +148,21 @@ TEST_F(ByteFileTest, AddChunk_ConstRefKey_Works) {
     );
 }
 
+TEST_F(ByteFileTest, InitChunksFromFile_TruncatedFile_FailingChunkUninitialized) {
+    auto path = test_dir_ / "truncated.bin";
+    {
+        std::ofstream f(path, std::ios::binary);
+        WriteU32LE(f, 1);
+        WriteU32LE(f, 2);
+        WriteU32LE(f, 50);  // заявлено 50 байт, в файле их нет
+    }
+    auto file = MakeFile(path.string());
+
+    EXPECT_THROW(file.InitChunksFromFile(), std::out_of_range);
+    EXPECT_TRUE(file.GetChunk(Slots::kSecond).IsInitialized());
+    EXPECT_FALSE(file.GetChunk(Slots::kThird).IsInitialized());
+}
+
 // ==================== GetChunk ====================
 
 TEST_F(ByteFileTest, GetChunk_ExistingKey_NoThrow) {
@@ -257,6 +305,76 @@ TEST_F(ByteFileTest, Compile_AfterModificationAndCommit_PersistsChange) {
     EXPECT_EQ(v.GetNum<uint32_t>(), 999u);
 }
 
+TEST_F(ByteFileTest, Compile_MiddleChunkChanged_CopiesUntouchedChunks) {
+    std::vector<uint8_t> payload(100000);
+    for (size_t i = 0; i < payload.size(); ++i) payload[i] = static_cast<uint8_t>(i % 251);
+    auto path = CreateFile("compile_middle.bin", 7, 8, payload);
+    {
+        auto file = MakeFile(path);
+        file.InitChunksFromFile();
+
+        auto& storage = file.GetAndLoadChunk(Slots::kSecond).GetStorage();
+        wiseio::NumView view(storage.GetData(), wiseio::Endianness::kLittleEndian);
+        view.SetNum<uint32_t>(123456);
+
+        file.Compile(wiseio::CompileMode::kRewrite);
+    }
+
+    auto file2 = MakeFile(path);
+    file2.InitChunksFromFile();
+    wiseio::NumView v1(file2.GetAndLoadChunk(Slots::kFirst).GetStorage().GetData(),
+                       wiseio::Endianness::kLittleEndian);
+    wiseio::NumView v2(file2.GetAndLoadChunk(Slots::kSecond).GetStorage().GetData(),
+                       wiseio::Endianness::kLittleEndian);
+
+    EXPECT_EQ(v1.GetNum<uint32_t>(), 7u);
+    EXPECT_EQ(v2.GetNum<uint32_t>(), 123456u);
+    EXPECT_EQ(file2.GetAndLoadChunk(Slots::kThird).GetStorage().GetData(), payload);
+    EXPECT_EQ(fs::file_size(path), 12 + payload.size());
+}
+
+TEST_F(ByteFileTest, Compile_SameSizeChange_PatchesInPlace) {
+    auto path = CreateFile("compile_in_place.bin", 1, 2, {0x01, 0x02, 0x03});
+    auto inode = GetInode(path);
+    {
+        auto file = MakeFile(path);
+        file.InitChunksFromFile();
+
+        auto& storage = file.GetAndLoadChunk(Slots::kFirst).GetStorage();
+        wiseio::NumView view(storage.GetData(), wiseio::Endianness::kLittleEndian);
+        view.SetNum<uint32_t>(77);
+        file.GetAndLoadChunk(Slots::kThird).GetStorage().GetData() = {0x0A, 0x0B, 0x0C};
+
+        file.Compile(wiseio::CompileMode::kAuto, true);
+    }
+    EXPECT_EQ(GetInode(path), inode);
+
+    auto file2 = MakeFile(path);
+    file2.InitChunksFromFile();
+    wiseio::NumView v(file2.GetAndLoadChunk(Slots::kFirst).GetStorage().GetData(),
+                      wiseio::Endianness::kLittleEndian);
+    EXPECT_EQ(v.GetNum<uint32_t>(), 77u);
+    EXPECT_EQ(file2.GetAndLoadChunk(Slots::kThird).GetStorage().GetData(),
+              std::vector<uint8_t>({0x0A, 0x0B, 0x0C}));
+}
+
+TEST_F(ByteFileTest, Compile_SizeChange_RewritesFile) {
+    auto path = CreateFile("compile_grow.bin", 1, 2, {0x01});
+    auto inode = GetInode(path);
+    {
+        auto file = MakeFile(path);
+        file.InitChunksFromFile();
+        file.GetAndLoadChunk(Slots::kThird).GetStorage().GetData() = {0x01, 0x02, 0x03, 0x04};
+        file.Compile();
+    }
+    EXPECT_NE(GetInode(path), inode);
+
+    auto file2 = MakeFile(path);
+    file2.InitChunksFromFile();
+    EXPECT_EQ(file2.GetAndLoadChunk(Slots::kThird).GetStorage().GetData(),
+              std::vector<uint8_t>({0x01, 0x02, 0x03, 0x04}));
+}
+
 // ==================== String-ключ (ByteFile<std::string>) ====================
 
 TEST_F(ByteFileTest, StringKey_AddAndGet_Works) {
@@ -312,4 +430,82 @@ TEST_F(ByteFileTest, MoveAssignment_Works) {
     EXPECT_NO_THROW(file2.InitChunksFromFile());
 }
 
+// ==================== Арена ====================
+
+TEST_F(ByteFileTest, Arena_ChunksAllocatedInResource) {
+    auto path = CreateFile("arena.bin", 7, 42, {0x01, 0x02, 0x03});
+    CountingResource resource;
+    {
+        wiseio::ByteFile<Slots> file(path.c_str(), &resource);
+        EXPECT_EQ(file.GetResource(), &resource);
+        file.AddChunk(wiseio::MakeNumChunk(file.GetResource(), wiseio::NumSize::kUint32_t), Slots::kFirst);
+        file.AddChunk(wiseio::MakeNumChunk(file.GetResource(), wiseio::NumSize::kUint32_t), Slots::kSecond);
+        file.AddChunk(wiseio::MakeByteChunk(file.GetResource(), wiseio::NumSize::kUint32_t), Slots::kThird);
+        EXPECT_GE(resource.allocations, 3u);
+        file.InitChunksFromFile();
+
+        auto& chunk = file.GetAndLoadChunk(Slots::kSecond);
+        wiseio::NumView view(chunk.GetStorage().GetData(), wiseio::Endianness::kLittleEndian);
+        EXPECT_EQ(view.GetNum<uint32_t>(), 42u);
+        EXPECT_EQ(file.GetAndLoadChunk(Slots::kThird).GetStorage().GetData(), std::vector<uint8_t>({0x01, 0x02, 0x03}));
+    }
+    EXPECT_EQ(resource.outstanding, 0u);
+}
+
+// Загруженные байты хранилища тоже берутся из ресурса
+TEST_F(ByteFileTest, Arena_PayloadAllocatedInResource) {
+    std::vector<uint8_t> payload(64 * 1024, 0x5A);
+    auto path = CreateFile("arena_payload.bin", 1, 2, payload);
+    CountingResource resource;
+    {
+        wiseio::ByteFile<Slots> file(path.c_str(), &resource);
+        file.AddChunk(wiseio::MakeNumChunk(file.GetResource(), wiseio::NumSize::kUint32_t), Slots::kFirst);
+        file.AddChunk(wiseio::MakeNumChunk(file.GetResource(), wiseio::NumSize::kUint32_t), Slots::kSecond);
+        file.AddChunk(wiseio::MakeByteChunk(file.GetResource(), wiseio::NumSize::kUint32_t), Slots::kThird);
+        file.InitChunksFromFile();
+
+        size_t before = resource.outstanding;
+        auto& data = file.GetAndLoadChunk(Slots::kThird).GetStorage().GetData();
+        EXPECT_EQ(data, payload);
+        EXPECT_EQ(data.get_allocator().resource(), &resource);
+        EXPECT_GE(resource.outstanding - before, payload.size());
+    }
+    EXPECT_EQ(resource.outstanding, 0u);
+}
+
+TEST_F(ByteFileTest, Arena_MonotonicBuffer_CompileWorks) {
+    auto path = CreateFile("arena_compile.bin", 1, 2, {0xAA, 0xBB});
+    std::array<std::byte, 16 * 1024> memory;
+    std::pmr::monotonic_buffer_resource arena(memory.data(), memory.size(), std::pmr::null_memory_resource());
+    {
+        wiseio::ByteFile<Slots> file(path.c_str(), &arena);
+        file.AddChunk(wiseio::MakeNumChunk(&arena, wiseio::NumSize::kUint32_t), Slots::kFirst);
+        file.AddChunk(wiseio::MakeNumChunk(&arena, wiseio::NumSize::kUint32_t), Slots::kSecond);
+        file.AddChunk(wiseio::MakeByteChunk(&arena, wiseio::NumSize::kUint32_t), Slots::kThird);
+        file.InitChunksFromFile();
+        file.GetAndLoadChunk(Slots::kThird).GetStorage().GetData() = {0x10, 0x20, 0x30};
+        file.Compile();
+    }
+    arena.release();
+
+    auto reread = MakeFile(path);
+    reread.InitChunksFromFile();
+    EXPECT_EQ(reread.GetAndLoadChunk(Slots::kThird).GetStorage().GetData(), std::vector<uint8_t>({0x10, 0x20, 0x30}));
+}
+
+TEST_F(ByteFileTest, Arena_MixedWithHeapChunks) {
+    auto path = CreateFile("arena_mixed.bin", 5, 6, {});
+    CountingResource resource;
+    {
+        wiseio::ByteFile<Slots> file(path.c_str(), &resource);
+        file.AddChunk(wiseio::MakeNumChunk(wiseio::NumSize::kUint32_t), Slots::kFirst);
+        file.AddChunk(wiseio::MakeNumChunk(&resource, wiseio::NumSize::kUint32_t), Slots::kSecond);
+        file.InitChunksFromFile();
+
+        wiseio::NumView view(file.GetAndLoadChunk(Slots::kFirst).GetStorage().GetData(), wiseio::Endianness::kLittleEndian);
+        EXPECT_EQ(view.GetNum<uint32_t>(), 5u);
+    }
+    EXPECT_EQ(resource.outstanding, 0u);
+}
+
 // NOLINTEND
\ No newline at end of file
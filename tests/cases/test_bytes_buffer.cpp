@@ -1,5 +1,7 @@
 // NOLINTBEGIN
 #include <gtest/gtest.h>
+#include <array>
+#include <span>
 #include <vector>
 #include <cstdint>
 #include <stdexcept>
@@ -249,6 +251,60 @@ TEST_F(BytesBufferTest, ReadFromBuffer_UpdatesCursor) {
     EXPECT_EQ(result[0], 4);
 }
 
+TEST_F(BytesBufferTest, ReadFromBuffer_Large) {
+    std::vector<uint8_t> data(1024 * 1024);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i % 253);
+    }
+    buffer_.AddDataToBuffer(data);
+    buffer_.SetCursor(0);
+
+    auto result = buffer_.ReadFromBuffer(data.size());
+    EXPECT_EQ(result, data);
+    EXPECT_FALSE(buffer_.IsData());
+}
+
+TEST_F(BytesBufferTest, ReadFromBuffer_IntoSpan) {
+    std::vector<uint8_t> data = {1, 2, 3, 4, 5};
+    buffer_.AddDataToBuffer(data);
+    buffer_.SetCursor(1);
+
+    std::array<uint8_t, 3> out {};
+    EXPECT_EQ(buffer_.ReadFromBuffer(std::span<uint8_t>(out)), 3);
+    EXPECT_EQ(out, (std::array<uint8_t, 3> {2, 3, 4}));
+    EXPECT_EQ(buffer_.ReadFromBuffer(std::span<uint8_t>(out)), 1);
+    EXPECT_EQ(out[0], 5);
+}
+
+TEST_F(BytesBufferTest, ReadFromBuffer_CursorPastShrunkEnd) {
+    std::vector<uint8_t> data = {1, 2, 3, 4, 5};
+    buffer_.AddDataToBuffer(data);
+    buffer_.SetCursor(4);
+    buffer_.ResizeBuffer(2);
+
+    EXPECT_TRUE(buffer_.ReadFromBuffer(3).empty());
+    EXPECT_TRUE(buffer_.Slice(3).empty());
+}
+
+// ==================== Slice ====================
+
+TEST_F(BytesBufferTest, Slice_NoCopy) {
+    std::vector<uint8_t> data = {1, 2, 3, 4, 5};
+    buffer_.AddDataToBuffer(data);
+    buffer_.SetCursor(0);
+
+    auto first = buffer_.Slice(2);
+    auto second = buffer_.Slice(10);
+
+    EXPECT_EQ(first.data(), buffer_.GetDataPtr());
+    EXPECT_EQ(first.size(), 2);
+    EXPECT_EQ(second.data(), buffer_.GetDataPtr() + 2);
+    EXPECT_EQ(second.size(), 3);
+    EXPECT_EQ(second[0], 3);
+    EXPECT_FALSE(buffer_.IsData());
+    EXPECT_TRUE(buffer_.Slice(1).empty());
+}
+
 // ==================== Clear ====================
 
 TEST_F(BytesBufferTest, Clear_EmptyBuffer) {
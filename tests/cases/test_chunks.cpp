@@ -4,6 +4,7 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include <logging/logger.hpp>
@@ -148,6 +149,46 @@ TEST_F(ChunkTest, ByteChunk_NotInitialized_Initially) {
 
 // ==================== NumChunk Init + Load ====================
 
+TEST_F(ChunkTest, NumChunk_Init_TruncatedFile_ThrowsAndStaysUninitialized) {
+    auto path = test_dir_ / "num_short.bin";
+    {
+        std::ofstream f(path, std::ios::binary);
+        WriteBytes(f, {0x01, 0x02});
+    }
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite);
+
+    auto chunk = wiseio::MakeNumChunk(wiseio::NumSize::kUint64_t);
+    EXPECT_THROW(chunk->Init(stream), std::out_of_range);
+    EXPECT_FALSE(chunk->IsInitialized());
+}
+
+TEST_F(ChunkTest, ByteChunk_Init_TruncatedPayload_ThrowsAndStaysUninitialized) {
+    auto path = test_dir_ / "byte_short.bin";
+    {
+        std::ofstream f(path, std::ios::binary);
+        WriteU32LE(f, 100);
+        WriteBytes(f, {0x01, 0x02});
+    }
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite);
+
+    auto chunk = wiseio::MakeByteChunk(wiseio::NumSize::kUint32_t);
+    EXPECT_THROW(chunk->Init(stream), std::out_of_range);
+    EXPECT_FALSE(chunk->IsInitialized());
+}
+
+TEST_F(ChunkTest, ByteChunk_Init_TruncatedHeader_Throws) {
+    auto path = test_dir_ / "byte_header.bin";
+    {
+        std::ofstream f(path, std::ios::binary);
+        WriteBytes(f, {0x01});
+    }
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite);
+
+    auto chunk = wiseio::MakeByteChunk(wiseio::NumSize::kUint32_t);
+    EXPECT_THROW(chunk->Init(stream), std::out_of_range);
+    EXPECT_FALSE(chunk->IsInitialized());
+}
+
 TEST_F(ChunkTest, NumChunk_Init_SetsInitialized) {
     auto path = MakeNumChunkFile("num_init.bin", 42);
     auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite);
@@ -315,6 +356,19 @@ TEST_F(ChunkTest, ByteChunk_GetSize_AfterInit) {
     EXPECT_EQ(chunk->GetSize(), 3u);
 }
 
+TEST_F(ChunkTest, ByteChunk_GetCompiledSize_IncludesLengthPrefix) {
+    std::vector<uint8_t> payload = {1, 2, 3};
+    auto path = MakeByteChunkFile("byte_compiled_size.bin", payload);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite);
+
+    auto chunk = wiseio::MakeByteChunk(wiseio::NumSize::kUint32_t);
+    chunk->Init(stream);
+    EXPECT_EQ(chunk->GetCompiledSize(), 7u);
+
+    chunk->GetStorage().GetData() = {1, 2, 3, 4, 5};
+    EXPECT_EQ(chunk->GetCompiledSize(), 9u);
+}
+
 // ==================== ValidateChunk Init ====================
 
 TEST_F(ChunkTest, ValidateChunk_Init_MatchingBytes_NoThrow) {
@@ -0,0 +1,219 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "wise-io/buffer.hpp"
+#include "wise-io/stream.hpp"
+
+#include "file_test.hpp"
+
+namespace fs = std::filesystem;
+
+class RingBufferTest : public FileTest<> {
+protected:
+    RingBufferTest() : FileTest("wiseio_ring_tests") {}
+};
+
+// ==================== Создание ====================
+
+TEST_F(RingBufferTest, Constructor_Empty) {
+    wiseio::RingIOBuffer ring(16);
+    EXPECT_EQ(ring.GetCapacity(), 16);
+    EXPECT_EQ(ring.GetSize(), 0);
+    EXPECT_EQ(ring.GetFree(), 16);
+    EXPECT_TRUE(ring.IsEmpty());
+    EXPECT_EQ(ring.GetWriteWindow().size(), 16);
+    EXPECT_TRUE(ring.GetReadWindow().empty());
+}
+
+TEST_F(RingBufferTest, Constructor_ZeroCapacity_Throws) {
+    EXPECT_THROW(wiseio::RingIOBuffer(0), std::invalid_argument);
+}
+
+TEST_F(RingBufferTest, Move_SourceLeftEmpty) {
+    auto data = MakePattern(10);
+    wiseio::RingIOBuffer ring(16);
+    ASSERT_EQ(ring.Write(data), 10);
+    ring.Consume(3);
+
+    wiseio::RingIOBuffer moved(std::move(ring));
+    EXPECT_EQ(moved.GetSize(), 7);
+    EXPECT_EQ(ring.GetCapacity(), 0);
+    EXPECT_EQ(ring.GetSize(), 0);
+    EXPECT_EQ(ring.GetFree(), 0);
+    EXPECT_EQ(ring.Write(data), 0);
+    EXPECT_TRUE(ring.GetWriteWindow().empty());
+
+    wiseio::RingIOBuffer assigned(4);
+    assigned = std::move(moved);
+    EXPECT_EQ(moved.GetCapacity(), 0);
+    EXPECT_EQ(moved.GetFree(), 0);
+    EXPECT_TRUE(moved.GetReadWindow().empty());
+    std::vector<uint8_t> out(7);
+    EXPECT_EQ(assigned.Read(out), 7);
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin() + 3));
+}
+
+// ==================== Окна ====================
+
+TEST_F(RingBufferTest, Windows_CommitAndConsume) {
+    wiseio::RingIOBuffer ring(8);
+    auto window = ring.GetWriteWindow();
+    ASSERT_EQ(window.size(), 8);
+    window[0] = 1;
+    window[1] = 2;
+    window[2] = 3;
+    ring.CommitWrite(3);
+
+    EXPECT_EQ(ring.GetSize(), 3);
+    EXPECT_EQ(ring.GetWriteWindow().size(), 5);
+    auto read = ring.GetReadWindow();
+    ASSERT_EQ(read.size(), 3);
+    EXPECT_EQ(read[2], 3);
+
+    ring.Consume(2);
+    EXPECT_EQ(ring.GetReadWindow().size(), 1);
+    EXPECT_EQ(ring.GetReadWindow()[0], 3);
+}
+
+TEST_F(RingBufferTest, Windows_StopAtWrap) {
+    wiseio::RingIOBuffer ring(8);
+    auto data = MakePattern(6);
+    EXPECT_EQ(ring.Write(data), 6);
+    ring.Consume(4);
+
+    // хвост в позиции 6: окно записи до конца памяти, затем с начала до head
+    EXPECT_EQ(ring.GetWriteWindow().size(), 2);
+    ring.CommitWrite(2);
+    EXPECT_EQ(ring.GetWriteWindow().size(), 4);
+    ring.CommitWrite(4);
+    EXPECT_TRUE(ring.IsFull());
+    EXPECT_TRUE(ring.GetWriteWindow().empty());
+    EXPECT_EQ(ring.GetReadWindow().size(), 4);
+}
+
+TEST_F(RingBufferTest, Commit_TooLarge_Throws) {
+    wiseio::RingIOBuffer ring(4);
+    EXPECT_THROW(ring.CommitWrite(5), std::out_of_range);
+    EXPECT_THROW(ring.Consume(1), std::out_of_range);
+}
+
+TEST_F(RingBufferTest, Consume_AllRewinds) {
+    wiseio::RingIOBuffer ring(8);
+    auto data = MakePattern(5);
+    ring.Write(data);
+    ring.Consume(5);
+
+    EXPECT_TRUE(ring.IsEmpty());
+    EXPECT_EQ(ring.GetWriteWindow().size(), 8);
+    EXPECT_EQ(ring.GetWriteWindow().data(), ring.GetReadWindow().data());
+}
+
+// ==================== Копирование ====================
+
+TEST_F(RingBufferTest, WriteRead_AcrossWrap) {
+    wiseio::RingIOBuffer ring(10);
+    auto data = MakePattern(100);
+    std::vector<uint8_t> result;
+
+    size_t offset = 0;
+    while (offset < data.size() || !ring.IsEmpty()) {
+        offset += ring.Write(std::span<const uint8_t>(data).subspan(offset, std::min<size_t>(7, data.size() - offset)));
+        std::vector<uint8_t> out(3);
+        out.resize(ring.Read(out));
+        result.insert(result.end(), out.begin(), out.end());
+    }
+    EXPECT_EQ(result, data);
+}
+
+TEST_F(RingBufferTest, Write_LimitedByFree) {
+    wiseio::RingIOBuffer ring(4);
+    auto data = MakePattern(10);
+    EXPECT_EQ(ring.Write(data), 4);
+    EXPECT_EQ(ring.Write(data), 0);
+    EXPECT_TRUE(ring.IsFull());
+
+    ring.Clear();
+    EXPECT_TRUE(ring.IsEmpty());
+    EXPECT_EQ(ring.GetFree(), 4);
+}
+
+// ==================== Работа со Stream ====================
+
+TEST_F(RingBufferTest, CRead_FillsWindow) {
+    auto data = MakePattern(1000);
+    auto path = test_dir_ / "ring.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    wiseio::RingIOBuffer ring(64);
+    std::vector<uint8_t> result;
+
+    while (true) {
+        while (!ring.IsFull() && !stream.IsEOF()) {
+            ssize_t len = stream.CRead(ring.GetWriteWindow());
+            if (len <= 0) {
+                break;
+            }
+            ring.CommitWrite(len);
+        }
+        if (ring.IsEmpty()) {
+            break;
+        }
+        auto window = ring.GetReadWindow();
+        std::span<const uint8_t> part = window.first(std::min<size_t>(window.size(), 40));
+        result.insert(result.end(), part.begin(), part.end());
+        ring.Consume(part.size());
+    }
+
+    EXPECT_EQ(result, data);
+    EXPECT_EQ(ring.GetCapacity(), 64);
+}
+
+TEST_F(RingBufferTest, CWrite_WrappedData_WritesOnlyData) {
+    wiseio::RingIOBuffer ring(8);
+    auto data = MakePattern(11);
+    ring.Write(std::span<const uint8_t>(data).first(6));
+    ring.Consume(5);
+    ring.Write(std::span<const uint8_t>(data).subspan(6));  // данные 5..10 переходят через край
+
+    auto path = test_dir_ / "ring_out.bin";
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+        while (!ring.IsEmpty()) {
+            auto window = ring.GetReadWindow();
+            ASSERT_TRUE(stream.CWrite(window));
+            ring.Consume(window.size());
+        }
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(written, std::vector<uint8_t>(data.begin() + 5, data.end()));
+}
+
+TEST_F(RingBufferTest, CustomReadAndCustomWrite_Windows) {
+    auto data = MakePattern(8);
+    auto path = test_dir_ / "ring_custom.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kReadAndWrite);
+    wiseio::RingIOBuffer ring(8);
+    ring.CommitWrite(stream.CustomRead(ring.GetWriteWindow(), 0));
+
+    auto window = ring.GetReadWindow();
+    EXPECT_EQ(std::vector<uint8_t>(window.begin(), window.end()), data);
+    ASSERT_TRUE(stream.CustomWrite(window, data.size()));
+    EXPECT_EQ(stream.GetFileSize(), 16);
+}
+// NOLINTEND
@@ -2,12 +2,14 @@
 #include <gtest/gtest.h>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <vector>
 
 #include <logging/logger.hpp>
 #include <logging/schemas.hpp>
 
 #include "wise-io/byte/storage.hpp"
+#include "wise-io/stream.hpp"
 
 namespace fs = std::filesystem;
 
@@ -126,11 +128,42 @@ TEST_F(StorageTest, Commit_MultipleTimes_LastValueWins) {
 TEST_F(StorageTest, Commit_BinaryData_RoundTrip) {
     wiseio::Storage storage;
     std::vector<uint8_t> expected = {0x00, 0xFF, 0x01, 0xFE, 0x7F, 0x80};
-    storage.GetData() = expected;
+    storage.GetData().assign(expected.begin(), expected.end());
     storage.Commit();
     EXPECT_EQ(storage.GetData(), expected);
 }
 
+// ==================== Load ====================
+
+// Старые данные заменяются диапазоном файла, а не дописываются к нему
+TEST_F(StorageTest, Load_LargeRange_ReplacesData) {
+    std::vector<uint8_t> file(700000);
+    for (size_t i = 0; i < file.size(); ++i) {
+        file[i] = static_cast<uint8_t>(i * 7 % 251);
+    }
+    auto path = cache_dir_ / "load.bin";
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), file.size());
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kRead);
+
+    wiseio::Storage storage;
+    storage.GetData() = {1, 2, 3};
+    storage.Load(stream, 100, 600000);
+
+    EXPECT_TRUE(storage.IsChanged());
+    EXPECT_EQ(storage.GetData(), std::vector<uint8_t>(file.begin() + 100, file.begin() + 600100));
+}
+
+TEST_F(StorageTest, Load_PastEnd_KeepsReadPart) {
+    std::vector<uint8_t> file = {10, 20, 30, 40, 50};
+    auto path = cache_dir_ / "short.bin";
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(file.data()), file.size());
+    auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kRead);
+
+    wiseio::Storage storage;
+    storage.Load(stream, 2, 100);
+    EXPECT_EQ(storage.GetData(), std::vector<uint8_t>({30, 40, 50}));
+}
+
 // ==================== SetCacheDir ====================
 
 TEST_F(StorageTest, SetCacheDir_ValidDir_NoThrow) {
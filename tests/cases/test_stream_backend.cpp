@@ -0,0 +1,380 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <cerrno>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+#include "wise-io/stream.hpp"
+#include "wise-io/schemas.hpp"
+
+#include "file_test.hpp"
+
+namespace fs = std::filesystem;
+
+class StreamBackendTest : public FileTest<::testing::TestWithParam<wiseio::IOBackend>> {
+protected:
+    StreamBackendTest() : FileTest("wiseio_backend_tests") {}
+};
+
+// ==================== Одиночные операции ====================
+
+TEST_P(StreamBackendTest, CRead_Sequential) {
+    auto data = MakePattern(1000);
+    auto path = CreateBinaryFile("cread.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> first(600);
+    std::vector<uint8_t> second(600);
+    EXPECT_EQ(stream.CRead(first), 600);
+    EXPECT_EQ(stream.CRead(second), 400);
+
+    EXPECT_EQ(stream.GetCursor(), 1000);
+    EXPECT_TRUE(stream.IsEOF());
+    EXPECT_TRUE(std::equal(first.begin(), first.end(), data.begin()));
+    EXPECT_TRUE(std::equal(second.begin(), second.end(), data.begin() + 600));
+}
+
+TEST_P(StreamBackendTest, CustomRead_Offset) {
+    auto data = MakePattern(4096);
+    auto path = CreateBinaryFile("custom.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> buffer(100);
+    EXPECT_EQ(stream.CustomRead(buffer, 2000), 100);
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin() + 2000));
+    EXPECT_EQ(stream.GetCursor(), 0);
+}
+
+TEST_P(StreamBackendTest, ReadAll_WholeFile) {
+    auto data = MakePattern(100000);
+    auto path = CreateBinaryFile("all.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(stream.ReadAll(buffer), 100000);
+    EXPECT_EQ(buffer, data);
+}
+
+TEST_P(StreamBackendTest, ReadAll_Parallel) {
+    auto data = MakePattern(100000);
+    auto path = CreateBinaryFile("all_parallel.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+    wiseio::ParallelReadOptions options {.split_size = 4096, .workers = 4};
+
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(stream.ReadAll(buffer, options), 100000);
+    EXPECT_EQ(buffer, data);
+    EXPECT_FALSE(stream.IsEOF());
+
+    std::string text;
+    EXPECT_EQ(stream.ReadAll(text, options), 100000);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), reinterpret_cast<const uint8_t*>(text.data())));
+}
+
+TEST_P(StreamBackendTest, ReadAll_Parallel_SmallFileFallsBack) {
+    auto data = MakePattern(1000);
+    auto path = CreateBinaryFile("all_small.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(stream.ReadAll(buffer, {.split_size = 4096, .workers = 8}), 1000);
+    EXPECT_EQ(buffer, data);
+}
+
+TEST_P(StreamBackendTest, CWrite_CustomWrite) {
+    auto path = (test_dir_ / "write.bin").string();
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite, false, GetParam());
+        EXPECT_TRUE(stream.CWrite(std::string("Hello World")));
+        EXPECT_EQ(stream.GetCursor(), 11);
+        EXPECT_TRUE(stream.CustomWrite(std::string("wiseio"), 6));
+    }
+    auto result = ReadFileBinary(path);
+    EXPECT_EQ(std::string(result.begin(), result.end()), "Hello wiseio");
+}
+
+// ==================== Пакетные операции ====================
+
+TEST_P(StreamBackendTest, BatchRead_MoreSegmentsThanQueueDepth) {
+    auto data = MakePattern(64 * 1024);
+    auto path = CreateBinaryFile("batch.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    constexpr size_t kSegments = 500;
+    std::vector<std::vector<uint8_t>> buffers(kSegments, std::vector<uint8_t>(64));
+    std::vector<wiseio::ReadSegment> segments;
+    for (size_t i = 0; i < kSegments; ++i) {
+        segments.push_back({buffers[i], (i * 7919) % (data.size() - 64)});
+    }
+
+    EXPECT_EQ(stream.CustomRead(segments), static_cast<ssize_t>(kSegments * 64));
+    for (size_t i = 0; i < kSegments; ++i) {
+        ASSERT_EQ(segments[i].buffer.size(), 64);
+        EXPECT_TRUE(std::equal(buffers[i].begin(), buffers[i].end(),
+                               data.begin() + segments[i].offset));
+    }
+}
+
+TEST_P(StreamBackendTest, BatchRead_SegmentPastEOF_Truncated) {
+    auto data = MakePattern(100);
+    auto path = CreateBinaryFile("batch_eof.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> head(10);
+    std::vector<uint8_t> tail(50);
+    std::vector<wiseio::ReadSegment> segments = {{head, 0}, {tail, 80}};
+
+    EXPECT_EQ(stream.CustomRead(segments), 30);
+    EXPECT_EQ(segments[0].buffer.size(), 10);
+    EXPECT_EQ(segments[1].buffer.size(), 20);
+    EXPECT_TRUE(std::equal(segments[1].buffer.begin(), segments[1].buffer.end(), data.begin() + 80));
+}
+
+TEST_P(StreamBackendTest, BatchRead_AdjacentSegments_CrossEOF) {
+    auto data = MakePattern(100);
+    auto path = CreateBinaryFile("batch_adjacent.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<std::vector<uint8_t>> buffers(4, std::vector<uint8_t>(30));
+    std::vector<wiseio::ReadSegment> segments;
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        segments.push_back({buffers[i], i * 30});
+    }
+
+    EXPECT_EQ(stream.CustomRead(segments), 100);
+    EXPECT_EQ(segments[0].buffer.size(), 30);
+    EXPECT_EQ(segments[1].buffer.size(), 30);
+    EXPECT_EQ(segments[2].buffer.size(), 30);
+    EXPECT_EQ(segments[3].buffer.size(), 10);
+    EXPECT_TRUE(std::equal(segments[3].buffer.begin(), segments[3].buffer.end(), data.begin() + 90));
+}
+
+TEST_P(StreamBackendTest, BatchWrite_ScatteredOffsets) {
+    auto path = (test_dir_ / "batch_write.bin").string();
+    std::string a = "AAAA";
+    std::string b = "BBBB";
+    std::string c = "CCCC";
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite, false, GetParam());
+        std::vector<wiseio::WriteSegment> segments = {
+            {std::span(reinterpret_cast<const uint8_t*>(c.data()), c.size()), 8},
+            {std::span(reinterpret_cast<const uint8_t*>(a.data()), a.size()), 0},
+            {std::span(reinterpret_cast<const uint8_t*>(b.data()), b.size()), 4},
+        };
+        EXPECT_TRUE(stream.CustomWrite(segments));
+    }
+    auto result = ReadFileBinary(path);
+    EXPECT_EQ(std::string(result.begin(), result.end()), "AAAABBBBCCCC");
+}
+
+TEST_P(StreamBackendTest, BatchWrite_WrongMode_Fails) {
+    auto path = CreateBinaryFile("batch_mode.bin", MakePattern(10));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> data = {1, 2, 3};
+    std::vector<wiseio::WriteSegment> segments = {{data, 0}};
+    EXPECT_FALSE(stream.CustomWrite(segments));
+}
+
+TEST_P(StreamBackendTest, MoveConstructor_KeepsBackend) {
+    auto data = MakePattern(32);
+    auto path = CreateBinaryFile("move.bin", data);
+    auto stream1 = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+    auto backend = stream1.GetBackend();
+
+    wiseio::Stream stream2(std::move(stream1));
+    EXPECT_EQ(stream2.GetBackend(), backend);
+
+    std::vector<uint8_t> buffer(32);
+    EXPECT_EQ(stream2.CustomRead(buffer, 0), 32);
+    EXPECT_EQ(buffer, data);
+}
+
+TEST_P(StreamBackendTest, CopyRange_BetweenBackends) {
+    auto data = MakePattern(3 * 1024 * 1024 + 123);
+    auto src_path = CreateBinaryFile("copy_src.bin", data);
+    auto dst_path = (test_dir_ / "copy_dst.bin").string();
+    auto src = wiseio::CreateStream(src_path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+    auto dst = wiseio::CreateStream(dst_path.c_str(), wiseio::OpenMode::kWrite, false, GetParam());
+
+    EXPECT_TRUE(src.CopyRange(dst, 4096, data.size() - 4096, 100));
+    dst.Close();
+
+    auto result = ReadFileBinary(dst_path);
+    ASSERT_EQ(result.size(), data.size() - 4096 + 100);
+    EXPECT_TRUE(std::equal(result.begin() + 100, result.end(), data.begin() + 4096));
+}
+
+// ==================== Подсказки ядру ====================
+
+TEST_P(StreamBackendTest, Advise_AllHints_Succeed) {
+    auto path = CreateBinaryFile("advise.bin", MakePattern(100000));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    EXPECT_TRUE(stream.Advise(wiseio::AccessAdvice::kSequential));
+    EXPECT_TRUE(stream.Advise(wiseio::AccessAdvice::kRandom));
+    EXPECT_TRUE(stream.Advise(wiseio::AccessAdvice::kWillNeed, 4096, 8192));
+    EXPECT_TRUE(stream.Advise(wiseio::AccessAdvice::kDontNeed, 100, 50));
+    EXPECT_TRUE(stream.Advise(wiseio::AccessAdvice::kNormal));
+}
+
+TEST_P(StreamBackendTest, Advise_ClosedStream_Fails) {
+    auto path = CreateBinaryFile("advise_closed.bin", MakePattern(10));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+    stream.Close();
+
+    EXPECT_FALSE(stream.Advise(wiseio::AccessAdvice::kSequential));
+}
+
+TEST_P(StreamBackendTest, CRead_SmallReadsAcrossReadAheadWindows) {
+    auto data = MakePattern(5 * 1024 * 1024 + 17);
+    auto path = CreateBinaryFile("readahead.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> result;
+    std::vector<uint8_t> buffer;
+    while (!stream.IsEOF()) {
+        buffer.resize(65536);
+        ASSERT_GE(stream.CRead(buffer), 0);
+        result.insert(result.end(), buffer.begin(), buffer.end());
+    }
+    EXPECT_EQ(result, data);
+
+    std::vector<uint8_t> all;
+    EXPECT_EQ(stream.ReadAll(all), static_cast<ssize_t>(data.size()));
+    EXPECT_EQ(all, data);
+}
+
+// ==================== mmap ====================
+
+TEST_P(StreamBackendTest, MappedView_ZeroCopy) {
+    auto data = MakePattern(4096);
+    auto path = CreateBinaryFile("view.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    auto view = stream.GetMappedView(1000, 100);
+    if (stream.GetBackend() != wiseio::IOBackend::kMmap) {
+        EXPECT_TRUE(view.empty());
+        return;
+    }
+    ASSERT_EQ(view.size(), 100);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin() + 1000));
+    EXPECT_EQ(stream.GetMappedView().size(), 4096);
+    EXPECT_EQ(stream.GetMappedView(4000, 1000).size(), 96);
+    EXPECT_TRUE(stream.GetMappedView(5000, 10).empty());
+}
+
+// Отображение живет вместе со стримом: переезжает при перемещении и снимается при закрытии
+TEST_P(StreamBackendTest, MappedView_MovedAndClosed) {
+    auto data = MakePattern(4096);
+    auto path = CreateBinaryFile("view_move.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+    if (stream.GetBackend() != wiseio::IOBackend::kMmap) {
+        return;
+    }
+
+    wiseio::Stream moved(std::move(stream));
+    EXPECT_TRUE(stream.GetMappedView().empty());
+    auto view = moved.GetMappedView(100, 10);
+    ASSERT_EQ(view.size(), 10);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin() + 100));
+
+    moved.Close();
+    EXPECT_TRUE(moved.GetMappedView().empty());
+}
+
+TEST_P(StreamBackendTest, EmptyFile_ReadsEOF) {
+    auto path = CreateBinaryFile("empty.bin", {});
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> buffer(10);
+    EXPECT_EQ(stream.CRead(buffer), 0);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(stream.IsEOF());
+    EXPECT_TRUE(stream.GetMappedView().empty());
+}
+
+// ==================== Конкурентное чтение ====================
+
+TEST_P(StreamBackendTest, PRead_PastEOF_DoesNotLatch) {
+    auto data = MakePattern(1000);
+    auto path = CreateBinaryFile("pread_eof.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<uint8_t> buffer(100);
+    EXPECT_EQ(stream.PRead(buffer, 950), 50);
+    EXPECT_EQ(stream.PRead(buffer, 2000), 0);
+    EXPECT_FALSE(stream.IsEOF());
+
+    EXPECT_EQ(stream.PRead(buffer, 100), 100);
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin() + 100));
+    EXPECT_EQ(stream.CustomRead(buffer, 200), 100);
+    EXPECT_EQ(stream.GetCursor(), 0);
+}
+
+TEST_P(StreamBackendTest, PRead_WrongModeOrClosed_LeavesStreamState) {
+    auto path = CreateBinaryFile("pread_mode.bin", MakePattern(100));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+    std::vector<uint8_t> buffer(10);
+
+    errno = 0;
+    EXPECT_EQ(stream.PRead(buffer, 0), -1);
+    EXPECT_EQ(errno, EBADF);
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kNone);
+
+    stream.Close();
+    EXPECT_EQ(stream.PRead(buffer, 0), -1);
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kNone);
+}
+
+TEST_P(StreamBackendTest, PRead_SharedAcrossThreads) {
+    constexpr size_t kThreads = 8;
+    constexpr size_t kBlock = 4096;
+    auto data = MakePattern(kThreads * 64 * kBlock);
+    auto path = CreateBinaryFile("pread_threads.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead, false, GetParam());
+
+    std::vector<size_t> mismatches(kThreads, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<uint8_t> buffer(kBlock + 100);
+            // Каждый поток читает блоки вперемешку с остальными, последний запрос упирается в конец файла
+            for (size_t block = t; block < data.size() / kBlock; block += kThreads) {
+                size_t offset = block * kBlock;
+                size_t expected = std::min(buffer.size(), data.size() - offset);
+                ssize_t len = stream.PRead(buffer, offset);
+                if (len != static_cast<ssize_t>(expected)
+                        || !std::equal(buffer.begin(), buffer.begin() + len, data.begin() + offset)) {
+                    ++mismatches[t];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 0; t < kThreads; ++t) {
+        EXPECT_EQ(mismatches[t], 0u) << "thread " << t;
+    }
+    EXPECT_FALSE(stream.IsEOF());
+}
+
+TEST(StreamMmapTest, WriteMode_FallsBackToSync) {
+    auto path = fs::temp_directory_path() / "wiseio_mmap_fallback.bin";
+    {
+        auto stream = wiseio::CreateStream(path, wiseio::OpenMode::kReadAndWrite, false, wiseio::IOBackend::kMmap);
+        EXPECT_EQ(stream.GetBackend(), wiseio::IOBackend::kSync);
+        EXPECT_TRUE(stream.CWrite(std::string("data")));
+    }
+    fs::remove(path);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Backends, StreamBackendTest,
+    ::testing::Values(
+        wiseio::IOBackend::kSync, wiseio::IOBackend::kIOUring,
+        wiseio::IOBackend::kMmap, wiseio::IOBackend::kDirect));
+// NOLINTEND
@@ -1,7 +1,11 @@
 // NOLINTBEGIN
 #include <gtest/gtest.h>
+#include <cerrno>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <system_error>
+#include <vector>
 
 
 #include "wise-io/stream.hpp"
@@ -124,6 +128,53 @@ TEST_F(StreamBasicTest, GetFileSize_LargeFile) {
     EXPECT_EQ(stream.GetFileSize(), 10000);
 }
 
+TEST_F(StreamBasicTest, GetFileSize_TracksWrites) {
+    auto path = (test_dir_ / "tracked.bin").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+
+    EXPECT_TRUE(stream.CWrite(std::string(100, 'a')));
+    EXPECT_EQ(stream.GetFileSize(), 100u);
+    EXPECT_TRUE(stream.CustomWrite(std::string(10, 'b'), 500));
+    EXPECT_EQ(stream.GetFileSize(), 510u);
+    EXPECT_TRUE(stream.CustomWrite(std::string(10, 'c'), 0));
+    EXPECT_EQ(stream.GetFileSize(), 510u);
+    EXPECT_EQ(stream.GetFileSize(), fs::file_size(path));
+    EXPECT_EQ(stream.GetCounters().stat_calls, 1u);
+}
+
+TEST_F(StreamBasicTest, GetFileSize_TracksAppend) {
+    auto path = CreateTestFile("tracked_append.txt", "head");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+
+    EXPECT_TRUE(stream.AWrite(std::string("tail")));
+    EXPECT_EQ(stream.GetFileSize(), 8u);
+}
+
+TEST_F(StreamBasicTest, RefreshFileSize_SeesExternalChanges) {
+    auto path = CreateTestFile("external.txt", "0123");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "456789";
+    }
+
+    EXPECT_EQ(stream.GetFileSize(), 4u);
+    EXPECT_EQ(stream.RefreshFileSize(), 10u);
+    EXPECT_EQ(stream.GetFileSize(), 10u);
+    EXPECT_EQ(stream.GetCounters().stat_calls, 2u);
+}
+
+TEST_F(StreamBasicTest, SetCursor_NoStat) {
+    auto path = CreateTestFile("no_stat.txt", "0123456789");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        stream.SetCursor(i % 10);
+    }
+    EXPECT_EQ(stream.GetCounters().cursor_moves, 1000u);
+    EXPECT_EQ(stream.GetCounters().stat_calls, 1u);
+}
+
 // ==================== Тесты на SetCursor и IsEOF ====================
 
 TEST_F(StreamBasicTest, SetCursor_ValidPosition) {
@@ -173,4 +224,197 @@ TEST_F(StreamBasicTest, Close_MultipleCalls) {
     });
 }
 
+// ==================== Тесты на CreateTempStream ====================
+
+TEST_F(StreamBasicTest, CreateTempStream_NoDirectoryEntry) {
+    auto stream = wiseio::CreateTempStream(test_dir_);
+
+    EXPECT_TRUE(stream.IsOpen());
+    if (stream.IsAnonymous()) {
+        EXPECT_TRUE(std::filesystem::is_empty(test_dir_));
+    }
+
+    EXPECT_TRUE(stream.CWrite(std::string("temp data")));
+    std::string buffer(9, '\0');
+    EXPECT_EQ(stream.CustomRead(buffer, 0), 9);
+    EXPECT_EQ(buffer, "temp data");
+}
+
+// С O_TMPFILE и без него: незабранный временный файл не остается в каталоге
+TEST_F(StreamBasicTest, CreateTempStream_NothingLeftAfterClose) {
+    {
+        auto stream = wiseio::CreateTempStream(test_dir_);
+        EXPECT_TRUE(stream.CWrite(std::string("scratch")));
+    }
+    auto closed = wiseio::CreateTempStream(test_dir_);
+    closed.Close();
+    EXPECT_TRUE(std::filesystem::is_empty(test_dir_));
+}
+
+TEST_F(StreamBasicTest, CreateTempStream_RenamedFileKept) {
+    auto stream = wiseio::CreateTempStream(test_dir_);
+    EXPECT_TRUE(stream.CWrite(std::string("kept")));
+    if (stream.IsAnonymous()) {
+        ASSERT_TRUE(stream.Link(test_dir_ / "linked.tmp"));
+    }
+    stream.Rename("kept.txt");
+    stream.Close();
+
+    EXPECT_TRUE(std::filesystem::exists(test_dir_ / "kept.txt"));
+}
+
+TEST_F(StreamBasicTest, CreateTempStream_LinkGivesName) {
+    auto stream = wiseio::CreateTempStream(test_dir_);
+    if (!stream.IsAnonymous()) {
+        GTEST_SKIP() << "O_TMPFILE не поддерживается";
+    }
+    EXPECT_TRUE(stream.CWrite(std::string("linked")));
+
+    auto path = test_dir_ / "linked.txt";
+    EXPECT_TRUE(stream.Link(path));
+    EXPECT_FALSE(stream.IsAnonymous());
+    stream.Close();
+
+    std::ifstream file(path);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, "linked");
+}
+
+TEST_F(StreamBasicTest, CreateTempStream_LinkToExistingPath_Fails) {
+    auto path = CreateTestFile("existing.txt", "old");
+    auto stream = wiseio::CreateTempStream(test_dir_);
+    if (!stream.IsAnonymous()) {
+        GTEST_SKIP() << "O_TMPFILE не поддерживается";
+    }
+
+    EXPECT_FALSE(stream.Link(path));
+    EXPECT_TRUE(stream.IsAnonymous());
+}
+
+// ==================== Тесты на ошибки и логгер ====================
+
+TEST_F(StreamBasicTest, LastError_WrongMode) {
+    auto path = CreateTestFile("error_mode.txt", "data");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kNone);
+    EXPECT_FALSE(stream.CWrite(std::string("x")));
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kWrongMode);
+
+    stream.ClearError();
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kNone);
+}
+
+TEST_F(StreamBasicTest, LastError_WrongState) {
+    auto path = CreateTestFile("error_state.txt", "data");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    EXPECT_TRUE(stream.GetMappedView().empty());
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kWrongState);
+}
+
+TEST_F(StreamBasicTest, LastError_SurvivesMove) {
+    auto path = CreateTestFile("error_move.txt", "data");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    EXPECT_FALSE(stream.AWrite(std::string("x")));
+
+    auto moved = std::move(stream);
+    EXPECT_EQ(moved.GetLastError(), wiseio::StreamError::kWrongMode);
+}
+
+TEST_F(StreamBasicTest, Logger_SharedByDefault) {
+    EXPECT_EQ(wiseio::Stream::GetDefaultLogger(), &wiseio::Stream::GetSharedLogger());
+}
+
+TEST_F(StreamBasicTest, Logger_NullDefault) {
+    wiseio::Stream::SetDefaultLogger(nullptr);
+    auto path = CreateTestFile("null_logger.txt", "data");
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+        EXPECT_FALSE(stream.CWrite(std::string("x")));
+        EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kWrongMode);
+        std::string buffer(4, '\0');
+        EXPECT_EQ(stream.CRead(buffer), 4);
+    }
+    EXPECT_THROW(
+        (void) wiseio::CreateStream((test_dir_ / "missing" / "file.txt").c_str(), wiseio::OpenMode::kRead),
+        std::runtime_error);
+
+    logging::Logger custom {"custom"};
+    wiseio::Stream::SetDefaultLogger(&custom);
+    EXPECT_EQ(wiseio::Stream::GetDefaultLogger(), &custom);
+    wiseio::Stream::SetDefaultLogger(&wiseio::Stream::GetSharedLogger());
+}
+
+// ==================== Тесты на Try* ====================
+
+TEST_F(StreamBasicTest, TryRead_ReturnsSize) {
+    auto path = CreateTestFile("try_read.txt", "hello");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    std::vector<uint8_t> buffer(16);
+
+    auto result = stream.TryCRead(buffer);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 5);
+
+    auto positioned = stream.TryPRead(buffer, 1);
+    ASSERT_TRUE(positioned.has_value());
+    EXPECT_EQ(*positioned, 4);
+}
+
+TEST_F(StreamBasicTest, TryWrite_WrongMode) {
+    auto path = CreateTestFile("try_mode.txt", "data");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    std::vector<uint8_t> data {1, 2, 3};
+
+    auto result = stream.TryCWrite(data);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), wiseio::StreamError::kWrongMode);
+    EXPECT_EQ(stream.GetErrorCode(), wiseio::StreamError::kWrongMode);
+
+    EXPECT_EQ(stream.TryAWrite(data).error(), wiseio::StreamError::kWrongMode);
+}
+
+TEST_F(StreamBasicTest, TryRead_Closed) {
+    auto path = CreateTestFile("try_closed.txt", "data");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    stream.Close();
+    std::vector<uint8_t> buffer(4);
+
+    EXPECT_EQ(stream.TryCRead(buffer).error(), wiseio::StreamError::kClosed);
+    EXPECT_EQ(stream.TryPRead(buffer, 0).error(), wiseio::StreamError::kClosed);
+}
+
+TEST_F(StreamBasicTest, TryWrite_CarriesErrno) {
+    auto stream = wiseio::CreateStream("/dev/full", wiseio::OpenMode::kWrite);
+    std::vector<uint8_t> data(64, 1);
+
+    auto result = stream.TryCWrite(data);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), std::errc::no_space_on_device);
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kIO);
+    EXPECT_EQ(stream.GetErrorCode(), std::error_code(ENOSPC, std::generic_category()));
+
+    EXPECT_TRUE(stream.TryCustomWrite(std::span<const uint8_t>(data), 0).error() == std::errc::no_space_on_device);
+}
+
+TEST_F(StreamBasicTest, ErrorCode_ClearedAfterSuccess) {
+    auto path = CreateTestFile("try_clear.txt", "");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+    EXPECT_FALSE(stream.GetMappedView().data());
+    EXPECT_EQ(stream.GetErrorCode(), wiseio::StreamError::kWrongState);
+
+    std::vector<uint8_t> data {1, 2, 3};
+    auto result = stream.TryCWrite(data);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 3);
+    EXPECT_FALSE(stream.GetErrorCode());
+}
+
+TEST_F(StreamBasicTest, ErrorCategory_Messages) {
+    std::error_code code = wiseio::StreamError::kClosed;
+    EXPECT_STREQ(code.category().name(), "wiseio::Stream");
+    EXPECT_FALSE(code.message().empty());
+}
+
 // NOLINTEND
@@ -0,0 +1,246 @@
+// NOLINTBEGIN
+#include <gtest/gtest.h>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "wise-io/pool.hpp"
+#include "wise-io/stream.hpp"
+
+namespace fs = std::filesystem;
+
+class StreamPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_dir_ = fs::temp_directory_path() / "wiseio_pool_tests";
+        fs::create_directories(test_dir_);
+        logging::Logger::SetupLogger(logging::LoggerMode::kDebug, logging::LoggerIOMode::kSync, true);
+    }
+
+    void TearDown() override {
+        if (fs::exists(test_dir_)) {
+            fs::remove_all(test_dir_);
+        }
+    }
+
+    fs::path CreateTestFile(const std::string& name, const std::string& content) {
+        auto path = test_dir_ / name;
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+        file.close();
+        return path;
+    }
+
+    std::string ReadWhole(wiseio::Stream& stream) {
+        std::string data(stream.GetFileSize(), '\0');
+        stream.PRead(std::span<uint8_t>(reinterpret_cast<uint8_t*>(data.data()), data.size()), 0);
+        return data;
+    }
+
+    fs::path test_dir_;
+};
+
+// ==================== Acquire / Release ====================
+
+TEST_F(StreamPoolTest, Acquire_ReusesOpenStream) {
+    auto path = CreateTestFile("reuse.txt", "data");
+    wiseio::StreamPool pool(4);
+
+    wiseio::Stream* first = nullptr;
+    {
+        auto lease = pool.Acquire(path, wiseio::OpenMode::kRead);
+        first = &lease.Get();
+        EXPECT_EQ(ReadWhole(*lease), "data");
+    }
+    auto lease = pool.Acquire(path, wiseio::OpenMode::kRead);
+
+    EXPECT_EQ(&lease.Get(), first);
+    EXPECT_EQ(pool.GetOpenCount(), 1u);
+    EXPECT_EQ(pool.GetCounters().hits, 1u);
+    EXPECT_EQ(pool.GetCounters().misses, 1u);
+}
+
+TEST_F(StreamPoolTest, Acquire_DifferentModes_SeparateStreams) {
+    auto path = CreateTestFile("modes.txt", "data");
+    wiseio::StreamPool pool(4);
+
+    auto reader = pool.Acquire(path, wiseio::OpenMode::kRead);
+    auto writer = pool.Acquire(path, wiseio::OpenMode::kReadAndWrite);
+
+    EXPECT_NE(&reader.Get(), &writer.Get());
+    EXPECT_EQ(writer->GetMode(), wiseio::OpenMode::kReadAndWrite);
+    EXPECT_EQ(pool.GetOpenCount(), 2u);
+}
+
+TEST_F(StreamPoolTest, Acquire_MissingFile_Throws) {
+    wiseio::StreamPool pool(4);
+
+    EXPECT_THROW(
+        (void) pool.Acquire(test_dir_ / "missing.txt", wiseio::OpenMode::kRead),
+        std::runtime_error);
+    EXPECT_EQ(pool.GetOpenCount(), 0u);
+}
+
+TEST_F(StreamPoolTest, Lease_Move_ReleasesOnce) {
+    auto path = CreateTestFile("move.txt", "data");
+    wiseio::StreamPool pool(1);
+    {
+        auto lease = pool.Acquire(path, wiseio::OpenMode::kRead);
+        wiseio::StreamLease moved = std::move(lease);
+        EXPECT_EQ(ReadWhole(*moved), "data");
+    }
+    pool.Clear();
+    EXPECT_EQ(pool.GetOpenCount(), 0u);
+}
+
+// ==================== LRU ====================
+
+TEST_F(StreamPoolTest, Capacity_EvictsLeastRecentlyUsed) {
+    std::vector<fs::path> paths;
+    for (int i = 0; i < 4; ++i) {
+        paths.push_back(CreateTestFile("lru_" + std::to_string(i) + ".txt", std::to_string(i)));
+    }
+    wiseio::StreamPool pool(3);
+
+    (void) pool.Acquire(paths[0], wiseio::OpenMode::kRead);
+    (void) pool.Acquire(paths[1], wiseio::OpenMode::kRead);
+    (void) pool.Acquire(paths[2], wiseio::OpenMode::kRead);
+    (void) pool.Acquire(paths[0], wiseio::OpenMode::kRead);
+    (void) pool.Acquire(paths[3], wiseio::OpenMode::kRead);
+
+    EXPECT_EQ(pool.GetOpenCount(), 3u);
+    EXPECT_EQ(pool.GetCounters().evictions, 1u);
+
+    // paths[1] был самым старым и закрыт, paths[0] остался в пуле
+    (void) pool.Acquire(paths[0], wiseio::OpenMode::kRead);
+    EXPECT_EQ(pool.GetCounters().hits, 2u);
+    (void) pool.Acquire(paths[1], wiseio::OpenMode::kRead);
+    EXPECT_EQ(pool.GetCounters().misses, 5u);
+}
+
+TEST_F(StreamPoolTest, Capacity_LeasedStreamsNotEvicted) {
+    auto first = CreateTestFile("leased_0.txt", "0");
+    auto second = CreateTestFile("leased_1.txt", "1");
+    wiseio::StreamPool pool(1);
+
+    auto lease = pool.Acquire(first, wiseio::OpenMode::kRead);
+    {
+        auto other = pool.Acquire(second, wiseio::OpenMode::kRead);
+        EXPECT_EQ(pool.GetOpenCount(), 2u);
+        EXPECT_EQ(ReadWhole(*lease), "0");
+    }
+    EXPECT_EQ(pool.GetOpenCount(), 1u);
+    EXPECT_EQ(ReadWhole(*lease), "0");
+}
+
+// ==================== Invalidate ====================
+
+TEST_F(StreamPoolTest, Invalidate_ReopensReplacedFile) {
+    auto path = CreateTestFile("replaced.txt", "old");
+    wiseio::StreamPool pool(4);
+
+    auto lease = pool.Acquire(path, wiseio::OpenMode::kRead);
+    auto replacement = CreateTestFile("replacement.txt", "new!");
+    fs::rename(replacement, path);
+    pool.Invalidate(path);
+
+    auto fresh = pool.Acquire(path, wiseio::OpenMode::kRead);
+    EXPECT_EQ(ReadWhole(*lease), "old");
+    EXPECT_EQ(ReadWhole(*fresh), "new!");
+    EXPECT_EQ(pool.GetOpenCount(), 2u);
+
+    lease.Release();
+    EXPECT_EQ(pool.GetOpenCount(), 1u);
+}
+
+TEST_F(StreamPoolTest, Invalidate_ClosesIdleStreams) {
+    auto path = CreateTestFile("idle.txt", "data");
+    wiseio::StreamPool pool(4);
+
+    (void) pool.Acquire(path, wiseio::OpenMode::kRead);
+    (void) pool.Acquire(path, wiseio::OpenMode::kReadAndWrite);
+    pool.Invalidate(test_dir_ / "." / "idle.txt");
+
+    EXPECT_EQ(pool.GetOpenCount(), 0u);
+    EXPECT_EQ(pool.GetCounters().evictions, 2u);
+}
+
+// ==================== Многопоточность ====================
+
+TEST_F(StreamPoolTest, Threads_RoundRobin) {
+    std::vector<fs::path> paths;
+    for (int i = 0; i < 16; ++i) {
+        paths.push_back(CreateTestFile("rr_" + std::to_string(i) + ".txt", "file" + std::to_string(i)));
+    }
+    wiseio::StreamPool pool(5);
+
+    std::vector<int> errors(4, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int round = 0; round < 200; ++round) {
+                size_t index = (round + t) % paths.size();
+                auto lease = pool.Acquire(paths[index], wiseio::OpenMode::kRead);
+                if (ReadWhole(*lease) != "file" + std::to_string(index)) {
+                    ++errors[t];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int count : errors) {
+        EXPECT_EQ(count, 0);
+    }
+    EXPECT_LE(pool.GetOpenCount(), 5u);
+}
+
+// Одновременные промахи по одному файлу: в пуле остается один стрим, лишние закрываются
+TEST_F(StreamPoolTest, Threads_ConcurrentMiss_SingleEntry) {
+    auto path = CreateTestFile("miss.txt", "shared");
+    wiseio::StreamPool pool;
+
+    for (int round = 0; round < 20; ++round) {
+        pool.Clear();
+        std::vector<wiseio::StreamLease> leases(4);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < leases.size(); ++t) {
+            threads.emplace_back([&, t]() { leases[t] = pool.Acquire(path, wiseio::OpenMode::kRead); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(pool.GetOpenCount(), 1u);
+        for (auto& lease : leases) {
+            EXPECT_EQ(&lease.Get(), &leases[0].Get());
+        }
+    }
+    auto counters = pool.GetCounters();
+    EXPECT_EQ(counters.hits + counters.misses, 80u);
+}
+
+TEST_F(StreamPoolTest, Invalidate_DuringOpen_NotCached) {
+    auto path = CreateTestFile("race.txt", "old");
+    wiseio::StreamPool pool;
+
+    std::atomic<bool> is_done = false;
+    std::thread invalidator([&]() {
+        while (!is_done) {
+            pool.Invalidate(path);
+        }
+    });
+    for (int round = 0; round < 200; ++round) {
+        auto lease = pool.Acquire(path, wiseio::OpenMode::kRead);
+        EXPECT_EQ(ReadWhole(*lease), "old");
+    }
+    is_done = true;
+    invalidator.join();
+    EXPECT_LE(pool.GetOpenCount(), 1u);
+}
+// NOLINTEND
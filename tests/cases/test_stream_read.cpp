@@ -1,7 +1,11 @@
 // NOLINTBEGIN
 #include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <span>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <vector>
 #include "wise-io/stream.hpp"
@@ -250,6 +254,123 @@ TEST_F(StreamReadTest, CustomRead_Buffer_WithOffset) {
     EXPECT_EQ(bytes_read, 6);
 }
 
+// ==================== Параллельный ReadAll ====================
+
+TEST_F(StreamReadTest, ReadAll_Parallel_IOBuffer) {
+    std::vector<uint8_t> data(50000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i % 251);
+    }
+    auto path = CreateBinaryFile("parallel.bin", data);
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    wiseio::BytesIOBuffer buffer;
+    EXPECT_EQ(stream.ReadAll(buffer, {.split_size = 8192, .workers = 3}), 50000);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), buffer.GetDataPtr()));
+}
+
+TEST_F(StreamReadTest, ReadAll_Parallel_TruncatedFile) {
+    auto path = CreateBinaryFile("truncated.bin", std::vector<uint8_t>(40000, 7));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    fs::resize_file(path, 10000);
+
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(stream.ReadAll(buffer, {.split_size = 4096, .workers = 4}), 10000);
+    EXPECT_TRUE(stream.IsEOF());
+}
+
+// Потоки общие: повторные вызовы не запускают новые
+TEST_F(StreamReadTest, ReadAll_Parallel_ReusesWorkers) {
+    auto path = CreateBinaryFile("reuse.bin", std::vector<uint8_t>(40000, 3));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    auto count_threads = []() {
+        return std::distance(fs::directory_iterator("/proc/self/task"), fs::directory_iterator());
+    };
+
+    std::vector<uint8_t> buffer;
+    ASSERT_EQ(stream.ReadAll(buffer, {.split_size = 4096, .workers = 4}), 40000);
+    auto threads = count_threads();
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_EQ(stream.ReadAll(buffer, {.split_size = 4096, .workers = 4}), 40000);
+    }
+    EXPECT_EQ(count_threads(), threads);
+}
+
+TEST_F(StreamReadTest, CRead_Random_NoReadAhead) {
+    auto path = CreateBinaryFile("random.bin", std::vector<uint8_t>(5 * 1024 * 1024, 9));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    std::vector<uint8_t> buffer(65536);
+
+    ASSERT_EQ(stream.CRead(buffer), 65536);
+    EXPECT_EQ(stream.GetCounters().readahead_hints, 1);
+
+    ASSERT_TRUE(stream.Advise(wiseio::AccessAdvice::kRandom));
+    while (!stream.IsEOF()) {
+        buffer.resize(65536);
+        ASSERT_GE(stream.CRead(buffer), 0);
+    }
+    EXPECT_EQ(stream.GetCounters().readahead_hints, 1);
+}
+
+TEST_F(StreamReadTest, ReadAll_RestoresPreviousAdvice) {
+    auto path = CreateBinaryFile("advice.bin", std::vector<uint8_t>(3 * 1024 * 1024, 5));
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+    EXPECT_EQ(stream.GetAdvice(), wiseio::AccessAdvice::kNormal);
+    ASSERT_TRUE(stream.Advise(wiseio::AccessAdvice::kRandom));
+    ASSERT_TRUE(stream.Advise(wiseio::AccessAdvice::kWillNeed, 0, 4096));  // подсказка диапазона режим не меняет
+
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(stream.ReadAll(buffer), 3 * 1024 * 1024);
+    EXPECT_EQ(stream.GetAdvice(), wiseio::AccessAdvice::kRandom);
+    EXPECT_EQ(stream.ReadAll(buffer, {.split_size = 1024 * 1024, .workers = 3}), 3 * 1024 * 1024);
+    EXPECT_EQ(stream.GetAdvice(), wiseio::AccessAdvice::kRandom);
+}
+
+TEST_F(StreamReadTest, ReadAll_Parallel_WrongMode) {
+    auto path = CreateTestFile("parallel_mode.txt", "data");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+
+    std::vector<uint8_t> buffer;
+    EXPECT_EQ(stream.ReadAll(buffer, {}), 0);
+    EXPECT_EQ(stream.GetLastError(), wiseio::StreamError::kWrongMode);
+}
+
+// ==================== Чтение в span ====================
+
+TEST_F(StreamReadTest, CRead_Span_ShortReadKeepsCallerBuffer) {
+    auto path = CreateTestFile("span_cread.txt", "abc");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    std::array<uint8_t, 8> buffer;
+    buffer.fill('x');
+    ssize_t bytes_read = stream.CRead(std::span<uint8_t>(buffer));
+
+    EXPECT_EQ(bytes_read, 3);
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + 3), "abc");
+    EXPECT_EQ(buffer[3], 'x');
+    EXPECT_EQ(stream.GetCursor(), 3u);
+}
+
+TEST_F(StreamReadTest, CustomRead_ByteSpan_WithOffset) {
+    auto path = CreateTestFile("span_custom.txt", "Hello, World!");
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    std::vector<std::byte> buffer(5);
+    ssize_t bytes_read = stream.CustomRead(std::span<std::byte>(buffer), 7);
+
+    EXPECT_EQ(bytes_read, 5);
+    EXPECT_EQ(buffer[0], std::byte{'W'});
+    EXPECT_EQ(buffer[4], std::byte{'d'});
+}
+
+TEST_F(StreamReadTest, CRead_Span_WrongMode_ReturnsZero) {
+    auto path = (test_dir_ / "span_write_only.txt").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+
+    std::array<uint8_t, 4> buffer {};
+    EXPECT_EQ(stream.CRead(std::span<uint8_t>(buffer)), 0);
+}
+
 // ==================== Тесты на бинарные данные ====================
 
 TEST_F(StreamReadTest, CRead_BinaryData) {
@@ -1,5 +1,8 @@
 // NOLINTBEGIN
 #include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <span>
 #include <filesystem>
 #include <fstream>
 #include <string>
@@ -173,6 +176,36 @@ TEST_F(StreamWriteTest, CWrite_String_WithNulls) {
     EXPECT_TRUE(result);
 }
 
+// ==================== Запись из span ====================
+
+TEST_F(StreamWriteTest, CWrite_Span_Subrange) {
+    auto path = (test_dir_ / "span_cwrite.txt").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+
+    std::array<uint8_t, 6> data = {'s', 'p', 'a', 'n', '!', '?'};
+    EXPECT_TRUE(stream.CWrite(std::span<const uint8_t>(data).first(5)));
+    EXPECT_EQ(ReadFileContent(path), "span!");
+}
+
+TEST_F(StreamWriteTest, AWrite_ByteSpan_Success) {
+    auto path = (test_dir_ / "span_awrite.txt").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+
+    std::vector<std::byte> data = {std::byte{'o'}, std::byte{'k'}};
+    EXPECT_TRUE(stream.AWrite(std::span<const std::byte>(data)));
+    EXPECT_EQ(ReadFileContent(path), "ok");
+}
+
+TEST_F(StreamWriteTest, CustomWrite_Span_WithOffset) {
+    auto path = (test_dir_ / "span_custom.txt").string();
+    std::ofstream(path) << "12345";
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+
+    std::array<uint8_t, 2> data = {'A', 'B'};
+    EXPECT_TRUE(stream.CustomWrite(std::span<const uint8_t>(data), 1));
+    EXPECT_EQ(ReadFileContent(path), "1AB45");
+}
+
 // ==================== AWrite (Append mode) ====================
 
 TEST_F(StreamWriteTest, AWrite_Vector_NewFile) {
@@ -239,6 +272,20 @@ TEST_F(StreamWriteTest, AWrite_Buffer_Success) {
     EXPECT_EQ(ReadFileContent(path), "XYZ");
 }
 
+TEST_F(StreamWriteTest, AWrite_Gather_MultipleBuffers) {
+    auto path = (test_dir_ / "gather_append.txt").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+
+    std::vector<uint8_t> a = {'A', 'B'};
+    std::vector<uint8_t> empty;
+    std::vector<uint8_t> b = {'C', 'D', 'E'};
+    std::vector<std::span<const uint8_t>> buffers = {a, empty, b};
+
+    EXPECT_TRUE(stream.AWrite(buffers));
+    EXPECT_TRUE(stream.AWrite(buffers));
+    EXPECT_EQ(ReadFileContent(path), "ABCDEABCDE");
+}
+
 TEST_F(StreamWriteTest, AWrite_WrongMode_Fails) {
     auto path = (test_dir_ / "wrong_append_mode.txt").string();
     auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
@@ -336,6 +383,106 @@ TEST_F(StreamWriteTest, CustomWrite_WrongMode_Fails) {
     EXPECT_FALSE(result);
 }
 
+// ==================== Reserve ====================
+
+TEST_F(StreamWriteTest, Reserve_KeepsFileSize) {
+    auto path = (test_dir_ / "reserve.bin").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+
+    stream.Reserve(1024 * 1024);
+    EXPECT_EQ(stream.GetFileSize(), 0u);
+
+    std::vector<uint8_t> data = {'A', 'B', 'C'};
+    EXPECT_TRUE(stream.AWrite(data));
+    EXPECT_EQ(ReadFileContent(path), "ABC");
+}
+
+TEST_F(StreamWriteTest, Reserve_ReadMode_Fails) {
+    auto path = (test_dir_ / "reserve_read.txt").string();
+    std::ofstream(path) << "data";
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kRead);
+
+    EXPECT_FALSE(stream.Reserve(4096));
+}
+
+// ==================== CopyRange ====================
+
+TEST_F(StreamWriteTest, CopyRange_CopiesBytesAtOffset) {
+    auto src_path = (test_dir_ / "copy_src.txt").string();
+    auto dst_path = (test_dir_ / "copy_dst.txt").string();
+    std::ofstream(src_path) << "0123456789";
+    std::ofstream(dst_path) << "abcdefgh";
+
+    auto src = wiseio::CreateStream(src_path.c_str(), wiseio::OpenMode::kRead);
+    auto dst = wiseio::CreateStream(dst_path.c_str(), wiseio::OpenMode::kWrite);
+
+    EXPECT_TRUE(src.CopyRange(dst, 3, 4, 2));
+    EXPECT_EQ(ReadFileContent(dst_path), "ab3456gh");
+}
+
+TEST_F(StreamWriteTest, CopyRange_PastEndOfSource_Fails) {
+    auto src_path = (test_dir_ / "copy_short_src.txt").string();
+    auto dst_path = (test_dir_ / "copy_short_dst.txt").string();
+    std::ofstream(src_path) << "0123";
+
+    auto src = wiseio::CreateStream(src_path.c_str(), wiseio::OpenMode::kRead);
+    auto dst = wiseio::CreateStream(dst_path.c_str(), wiseio::OpenMode::kWrite);
+
+    EXPECT_FALSE(src.CopyRange(dst, 2, 10, 0));
+}
+
+TEST_F(StreamWriteTest, CopyRange_AppendDestination_Fails) {
+    auto src_path = (test_dir_ / "copy_mode_src.txt").string();
+    auto dst_path = (test_dir_ / "copy_mode_dst.txt").string();
+    std::ofstream(src_path) << "0123";
+
+    auto src = wiseio::CreateStream(src_path.c_str(), wiseio::OpenMode::kRead);
+    auto dst = wiseio::CreateStream(dst_path.c_str(), wiseio::OpenMode::kAppend);
+
+    EXPECT_FALSE(src.CopyRange(dst, 0, 4, 0));
+}
+
+// ==================== Durability ====================
+
+TEST_F(StreamWriteTest, Durability_DefaultIsNone) {
+    auto path = (test_dir_ / "durability_default.txt").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+
+    EXPECT_EQ(stream.GetDurability(), wiseio::Durability::kNone);
+    stream.SetDurability(wiseio::Durability::kSyncOnClose);
+    EXPECT_EQ(stream.GetDurability(), wiseio::Durability::kSyncOnClose);
+}
+
+TEST_F(StreamWriteTest, Durability_WriteBehind_LargeWrite) {
+    auto path = (test_dir_ / "write_behind.bin").string();
+    std::vector<uint8_t> chunk(3 * 1024 * 1024);
+    for (size_t i = 0; i < chunk.size(); ++i) chunk[i] = static_cast<uint8_t>(i % 253);
+    {
+        auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kAppend);
+        stream.SetDurability(wiseio::Durability::kWriteBehind);
+        for (int i = 0; i < 7; ++i) {
+            ASSERT_TRUE(stream.AWrite(chunk));
+        }
+    }
+
+    auto result = ReadFileBinary(path);
+    ASSERT_EQ(result.size(), chunk.size() * 7);
+    EXPECT_TRUE(std::equal(chunk.begin(), chunk.end(), result.end() - chunk.size()));
+}
+
+TEST_F(StreamWriteTest, Durability_Full_RenameKeepsData) {
+    auto path = (test_dir_ / "durable_tmp.txt").string();
+    auto stream = wiseio::CreateStream(path.c_str(), wiseio::OpenMode::kWrite);
+    stream.SetDurability(wiseio::Durability::kFull);
+
+    EXPECT_TRUE(stream.CWrite(std::string("durable")));
+    stream.Rename("durable.txt");
+    stream.Close();
+
+    EXPECT_FALSE(fs::exists(path));
+    EXPECT_EQ(ReadFileContent((test_dir_ / "durable.txt").string()), "durable");
+}
+
 // ==================== ReadAndWrite mode ====================
 
 TEST_F(StreamWriteTest, ReadAndWrite_Mode_CanWrite) {
@@ -189,6 +189,28 @@ TEST_F(StringBufferTest, GetLine_NoMoreLines) {
     EXPECT_TRUE(line2.empty());
 }
 
+TEST_F(StringBufferTest, GetLine_LinesAcrossLargeBuffer) {
+    std::string data;
+    for (int i = 0; i < 1000; ++i) {
+        data += std::string(i % 300, static_cast<char>('a' + i % 26)) + "\n";
+    }
+    buffer_.AddDataToBuffer(data);
+    buffer_.SetCursor(0);
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(buffer_.GetLine(), std::string(i % 300, static_cast<char>('a' + i % 26)));
+    }
+    EXPECT_FALSE(buffer_.IsLines());
+}
+
+TEST_F(StringBufferTest, GetLine_EmbeddedNullKept) {
+    buffer_.AddDataToBuffer(std::string("a\0b\nc", 5));
+    buffer_.SetCursor(0);
+
+    EXPECT_EQ(buffer_.GetLine(), std::string("a\0b", 3));
+    EXPECT_EQ(buffer_.GetLine(), "c");
+}
+
 // ==================== SetIgnoreComments ====================
 
 TEST_F(StringBufferTest, IgnoreComments_Disabled_Default) {
@@ -231,6 +253,17 @@ TEST_F(StringBufferTest, IgnoreComments_NoSpaceBeforeHash) {
     EXPECT_EQ(line, "No#Comment");
 }
 
+TEST_F(StringBufferTest, IgnoreComments_LastLineComment_Returned) {
+    buffer_.SetIgnoreComments(true);
+    buffer_.AddDataToBuffer("Real\n  # tail comment");
+    buffer_.SetCursor(0);
+
+    EXPECT_EQ(buffer_.GetLine(), "Real");
+    // Последняя строка возвращается, даже если это комментарий: строк больше нет
+    EXPECT_EQ(buffer_.GetLine(), "  ");
+    EXPECT_FALSE(buffer_.IsLines());
+}
+
 TEST_F(StringBufferTest, IgnoreComments_MultipleComments) {
     buffer_.SetIgnoreComments(true);
     buffer_.AddDataToBuffer("# Comment 1\n# Comment 2\nReal\n# Comment 3\n");
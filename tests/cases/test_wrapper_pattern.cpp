@@ -145,7 +145,7 @@ TEST_F(FileWrapperTest, LoadFirstChunk_Value250_ExactlyAsInExample) {
     f.InitFromFile();
 
     wiseio::Storage& st = f.LoadFirstChunk();
-    std::vector<uint8_t>& buff = st.GetData();
+    wiseio::ByteBuffer& buff = st.GetData();
     wiseio::NumView view(buff, wiseio::Endianness::kLittleEndian);
 
     uint32_t val = view.GetNum<uint32_t>();